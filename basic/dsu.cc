@@ -1,5 +1,12 @@
 #include <basic/dsu.h>
 
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+using std::vector;
+using std::pair;
+
 DisjointSetUnion::DisjointSetUnion(int elements_count)
     : elements_(elements_count),
       components_count_(elements_count) {
@@ -43,3 +50,97 @@ void DisjointSetUnion::unite(int first_key, int second_key) {
     --components_count_;
   }
 }
+
+CompactDisjointSetUnion::CompactDisjointSetUnion(int elements_count)
+    : parents_(elements_count, -1),
+      components_count_(elements_count)
+  { }
+
+int CompactDisjointSetUnion::get_root(int key) {
+  // path halving, every other element on path skips its parent
+  while (parents_[key] >= 0) {
+    int parent = parents_[key];
+    if (parents_[parent] >= 0) {
+      parents_[key] = parents_[parent];
+    }
+    key = parents_[key];
+  }
+  return key;
+}
+
+bool CompactDisjointSetUnion::unite(int first_key, int second_key) {
+  int first_root = get_root(first_key);
+  int second_root = get_root(second_key);
+  if (first_root == second_root) {
+    return false;
+  }
+
+  // smaller set goes under bigger one
+  if (parents_[first_root] > parents_[second_root]) {
+    std::swap(first_root, second_root);
+  }
+  parents_[first_root] += parents_[second_root];
+  parents_[second_root] = first_root;
+  --components_count_;
+  return true;
+}
+
+// how many pairs ahead are prefetched in unite_many
+const int DSU_PREFETCH_DISTANCE = 16;
+
+void CompactDisjointSetUnion::unite_many(
+    const vector< pair<int, int> >& pairs) {
+  for (int pair_index = 0; pair_index < pairs.size(); ++pair_index) {
+    if (pair_index + DSU_PREFETCH_DISTANCE < pairs.size()) {
+      const pair<int, int>& next = pairs[pair_index + DSU_PREFETCH_DISTANCE];
+      __builtin_prefetch(&parents_[next.first]);
+      __builtin_prefetch(&parents_[next.second]);
+    }
+    unite(pairs[pair_index].first, pairs[pair_index].second);
+  }
+}
+
+ConcurrentDisjointSetUnion::ConcurrentDisjointSetUnion(int elements_count)
+    : parents_(elements_count),
+      components_count_(elements_count) {
+  for (int element_index = 0; element_index < elements_count; ++element_index) {
+    parents_[element_index] = element_index;
+  }
+}
+
+int ConcurrentDisjointSetUnion::get_root(int key) {
+  int parent = parents_[key];
+  while (parent != key) {
+    // path halving, failed swap means that other thread
+    // has already moved key higher
+    int grandparent = parents_[parent];
+    if (grandparent != parent) {
+      __sync_bool_compare_and_swap(&parents_[key], parent, grandparent);
+    }
+    key = grandparent;
+    parent = parents_[key];
+  }
+  return key;
+}
+
+bool ConcurrentDisjointSetUnion::unite(int first_key, int second_key) {
+  while (true) {
+    int first_root = get_root(first_key);
+    int second_root = get_root(second_key);
+    if (first_root == second_root) {
+      return false;
+    }
+
+    if (first_root > second_root) {
+      std::swap(first_root, second_root);
+    }
+    // fails if first root got linked meanwhile, then retry from it
+    if (__sync_bool_compare_and_swap(&parents_[first_root],
+                                     first_root, second_root)) {
+      __sync_fetch_and_sub(&components_count_, 1);
+      return true;
+    }
+    first_key = first_root;
+    second_key = second_root;
+  }
+}
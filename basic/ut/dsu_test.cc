@@ -1,7 +1,11 @@
 #include "basic/dsu.h"
 
+#include <pthread.h>
+
 #include <cstdlib>
 #include <iostream>
+#include <vector>
+#include <utility>
 
 #include "gtest/gtest.h"
 
@@ -38,3 +42,204 @@ TEST(DSUTest, Stress) {
     EXPECT_EQ(dsu.get_root(first_key), dsu.get_root(second_key));
   }
 }
+
+TEST(DSUTest, ConcurrentStress) {
+  const int ELEMENTS_COUNT = 100;
+  const int QUERIES_COUNT = 1000;
+  DisjointSetUnion dsu(ELEMENTS_COUNT);
+  ConcurrentDisjointSetUnion concurrent_dsu(ELEMENTS_COUNT);
+
+  srand(42);
+
+  for (int i = 0; i < QUERIES_COUNT; ++i) {
+    int first_key = rand() % ELEMENTS_COUNT;
+    int second_key = rand() % ELEMENTS_COUNT;
+
+    EXPECT_EQ(dsu.get_root(first_key) != dsu.get_root(second_key),
+              concurrent_dsu.unite(first_key, second_key));
+    dsu.unite(first_key, second_key);
+    EXPECT_EQ(concurrent_dsu.get_root(first_key),
+              concurrent_dsu.get_root(second_key));
+    EXPECT_EQ(dsu.get_components_count(),
+              concurrent_dsu.get_components_count());
+  }
+}
+
+// Each thread unites its own window of shared pairs, windows of
+// neighbouring threads overlap, so same pairs are united at once
+struct ConcurrentUniteTask {
+  ConcurrentDisjointSetUnion* dsu;
+  const std::vector< std::pair<int, int> >* pairs;
+  int begin;
+  int end;
+  int successful_unites_count;
+};
+
+void* run_concurrent_unites(void* argument) {
+  ConcurrentUniteTask* task = static_cast<ConcurrentUniteTask*>(argument);
+  for (int i = task->begin; i < task->end; ++i) {
+    if (task->dsu->unite((*task->pairs)[i].first,
+                         (*task->pairs)[i].second)) {
+      ++task->successful_unites_count;
+    }
+  }
+  return NULL;
+}
+
+TEST(DSUTest, ConcurrentThreadsStress) {
+  const int ELEMENTS_COUNT = 1000;
+  const int THREADS_COUNT = 4;
+  const int WINDOW_SIZE = 600;
+  const int WINDOW_STEP = 200;
+  const int PAIRS_COUNT = WINDOW_STEP * (THREADS_COUNT - 1) + WINDOW_SIZE;
+  const int ROUNDS_COUNT = 20;
+
+  srand(42);
+
+  for (int round = 0; round < ROUNDS_COUNT; ++round) {
+    std::vector< std::pair<int, int> > pairs(PAIRS_COUNT);
+    DisjointSetUnion dsu(ELEMENTS_COUNT);
+    for (int i = 0; i < PAIRS_COUNT; ++i) {
+      pairs[i] = std::make_pair(rand() % ELEMENTS_COUNT,
+                                rand() % ELEMENTS_COUNT);
+      dsu.unite(pairs[i].first, pairs[i].second);
+    }
+
+    ConcurrentDisjointSetUnion concurrent_dsu(ELEMENTS_COUNT);
+    std::vector<ConcurrentUniteTask> tasks(THREADS_COUNT);
+    std::vector<pthread_t> threads(THREADS_COUNT);
+    for (int thread_index = 0; thread_index < THREADS_COUNT; ++thread_index) {
+      ConcurrentUniteTask& task = tasks[thread_index];
+      task.dsu = &concurrent_dsu;
+      task.pairs = &pairs;
+      task.begin = thread_index * WINDOW_STEP;
+      task.end = task.begin + WINDOW_SIZE;
+      task.successful_unites_count = 0;
+      ASSERT_EQ(0, pthread_create(&threads[thread_index], NULL,
+                                  run_concurrent_unites, &task));
+    }
+    int successful_unites_count = 0;
+    for (int thread_index = 0; thread_index < THREADS_COUNT; ++thread_index) {
+      pthread_join(threads[thread_index], NULL);
+      successful_unites_count += tasks[thread_index].successful_unites_count;
+    }
+
+    // each successful unite merges two sets
+    EXPECT_EQ(dsu.get_components_count(),
+              concurrent_dsu.get_components_count());
+    EXPECT_EQ(ELEMENTS_COUNT - successful_unites_count,
+              concurrent_dsu.get_components_count());
+
+    // same partition: roots of both structures match one to one
+    std::vector<int> concurrent_roots(ELEMENTS_COUNT, -1);
+    for (int key = 0; key < ELEMENTS_COUNT; ++key) {
+      int& concurrent_root = concurrent_roots[dsu.get_root(key)];
+      if (concurrent_root == -1) {
+        concurrent_root = concurrent_dsu.get_root(key);
+      }
+      ASSERT_EQ(concurrent_root, concurrent_dsu.get_root(key));
+    }
+  }
+}
+
+TEST(DSUTest, CompactStress) {
+  const int ELEMENTS_COUNT = 100;
+  const int QUERIES_COUNT = 1000;
+  DisjointSetUnion dsu(ELEMENTS_COUNT);
+  CompactDisjointSetUnion compact_dsu(ELEMENTS_COUNT);
+  std::vector<int> set_sizes(ELEMENTS_COUNT, 1);
+
+  srand(42);
+
+  for (int i = 0; i < QUERIES_COUNT; ++i) {
+    int first_key = rand() % ELEMENTS_COUNT;
+    int second_key = rand() % ELEMENTS_COUNT;
+
+    int first_root = dsu.get_root(first_key);
+    int second_root = dsu.get_root(second_key);
+    EXPECT_EQ(first_root != second_root,
+              compact_dsu.unite(first_key, second_key));
+    dsu.unite(first_key, second_key);
+    if (first_root != second_root) {
+      set_sizes[dsu.get_root(first_key)] =
+          set_sizes[first_root] + set_sizes[second_root];
+    }
+
+    EXPECT_EQ(compact_dsu.get_root(first_key),
+              compact_dsu.get_root(second_key));
+    EXPECT_EQ(set_sizes[dsu.get_root(first_key)],
+              compact_dsu.get_set_size(first_key));
+    EXPECT_EQ(dsu.get_components_count(),
+              compact_dsu.get_components_count());
+  }
+}
+
+TEST(DSUTest, UniteMany) {
+  const int ELEMENTS_COUNT = 1000;
+  const int PAIRS_COUNT = 700;
+  CompactDisjointSetUnion dsu(ELEMENTS_COUNT);
+  CompactDisjointSetUnion batch_dsu(ELEMENTS_COUNT);
+
+  srand(42);
+
+  std::vector< std::pair<int, int> > pairs(PAIRS_COUNT);
+  for (int i = 0; i < PAIRS_COUNT; ++i) {
+    pairs[i] = std::make_pair(rand() % ELEMENTS_COUNT,
+                              rand() % ELEMENTS_COUNT);
+    dsu.unite(pairs[i].first, pairs[i].second);
+  }
+  batch_dsu.unite_many(pairs);
+
+  EXPECT_EQ(dsu.get_components_count(), batch_dsu.get_components_count());
+  for (int key = 0; key < ELEMENTS_COUNT; ++key) {
+    EXPECT_EQ(dsu.get_root(key), batch_dsu.get_root(key));
+  }
+}
+
+// random unions of 10^7 elements, 10^8 operations
+// are generated by batches
+const int DSU_MAX_TEST_ELEMENTS_COUNT = 10000000;
+const int DSU_MAX_TEST_BATCHES_COUNT = 100;
+const int DSU_MAX_TEST_BATCH_SIZE = 1000000;
+
+void generate_random_pairs(std::vector< std::pair<int, int> >& pairs) {
+  pairs.resize(DSU_MAX_TEST_BATCH_SIZE);
+  for (int i = 0; i < DSU_MAX_TEST_BATCH_SIZE; ++i) {
+    pairs[i] = std::make_pair(rand() % DSU_MAX_TEST_ELEMENTS_COUNT,
+                              rand() % DSU_MAX_TEST_ELEMENTS_COUNT);
+  }
+}
+
+TEST(DSUTest, UniteMaxTest) {
+  DisjointSetUnion dsu(DSU_MAX_TEST_ELEMENTS_COUNT);
+  std::vector< std::pair<int, int> > pairs;
+  srand(42);
+  for (int batch = 0; batch < DSU_MAX_TEST_BATCHES_COUNT; ++batch) {
+    generate_random_pairs(pairs);
+    for (int i = 0; i < pairs.size(); ++i) {
+      dsu.unite(pairs[i].first, pairs[i].second);
+    }
+  }
+}
+
+TEST(DSUTest, CompactUniteMaxTest) {
+  CompactDisjointSetUnion dsu(DSU_MAX_TEST_ELEMENTS_COUNT);
+  std::vector< std::pair<int, int> > pairs;
+  srand(42);
+  for (int batch = 0; batch < DSU_MAX_TEST_BATCHES_COUNT; ++batch) {
+    generate_random_pairs(pairs);
+    for (int i = 0; i < pairs.size(); ++i) {
+      dsu.unite(pairs[i].first, pairs[i].second);
+    }
+  }
+}
+
+TEST(DSUTest, CompactUniteManyMaxTest) {
+  CompactDisjointSetUnion dsu(DSU_MAX_TEST_ELEMENTS_COUNT);
+  std::vector< std::pair<int, int> > pairs;
+  srand(42);
+  for (int batch = 0; batch < DSU_MAX_TEST_BATCHES_COUNT; ++batch) {
+    generate_random_pairs(pairs);
+    dsu.unite_many(pairs);
+  }
+}
@@ -0,0 +1,388 @@
+#include "graph/alt.h"
+
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include "graph/common.h"
+#include "graph/heap.h"
+#include "graph/ssspp.h"
+
+using std::vector;
+
+AltIndex::AltIndex(const Graph& graph,
+                   int landmarks_count,
+                   LandmarkSelection selection)
+    : graph_(graph),
+      inverted_graph_(invert(graph)),
+      settled_vertices_count_(0) {
+  landmarks_count = std::min(landmarks_count, size());
+  if (selection == RANDOM_LANDMARKS) {
+    select_random_landmarks(landmarks_count);
+  } else if (selection == FARTHEST_LANDMARKS) {
+    select_farthest_landmarks(landmarks_count);
+  } else {
+    select_avoid_landmarks(landmarks_count);
+  }
+  reset_query_buffers();
+}
+
+void AltIndex::add_landmark(int landmark) {
+  vector<int> distance_from_new_landmark;
+  dijkstra_on_kary_heap<4>(graph_, landmark, distance_from_new_landmark);
+  vector<int> distance_to_new_landmark;
+  dijkstra_on_kary_heap<4>(inverted_graph_, landmark,
+                           distance_to_new_landmark);
+
+  int old_landmarks_count = landmarks_.size();
+  int new_landmarks_count = old_landmarks_count + 1;
+  vector<int> distance_from_landmarks(size() * new_landmarks_count);
+  vector<int> distance_to_landmarks(size() * new_landmarks_count);
+  for (int vertex = 0; vertex < size(); ++vertex) {
+    for (int i = 0; i < old_landmarks_count; ++i) {
+      distance_from_landmarks[vertex * new_landmarks_count + i] =
+          distance_from_landmark(i, vertex);
+      distance_to_landmarks[vertex * new_landmarks_count + i] =
+          distance_to_landmark(i, vertex);
+    }
+    distance_from_landmarks[vertex * new_landmarks_count +
+                            old_landmarks_count] =
+        distance_from_new_landmark[vertex];
+    distance_to_landmarks[vertex * new_landmarks_count +
+                          old_landmarks_count] =
+        distance_to_new_landmark[vertex];
+  }
+
+  landmarks_.push_back(landmark);
+  distance_from_landmarks_.swap(distance_from_landmarks);
+  distance_to_landmarks_.swap(distance_to_landmarks);
+}
+
+int AltIndex::lower_bound(int tail, int head) const {
+  int bound = 0;
+  for (int i = 0; i < landmarks_.size(); ++i) {
+    // d(tail, head) >= d(landmark, head) - d(landmark, tail)
+    int from_tail = distance_from_landmark(i, tail);
+    int from_head = distance_from_landmark(i, head);
+    if (from_tail != INFINITY) {
+      if (from_head == INFINITY) {
+        return INFINITY;
+      }
+      bound = std::max(bound, from_head - from_tail);
+    }
+
+    // d(tail, head) >= d(tail, landmark) - d(head, landmark)
+    int to_tail = distance_to_landmark(i, tail);
+    int to_head = distance_to_landmark(i, head);
+    if (to_head != INFINITY) {
+      if (to_tail == INFINITY) {
+        return INFINITY;
+      }
+      bound = std::max(bound, to_tail - to_head);
+    }
+  }
+  return bound;
+}
+
+void AltIndex::select_random_landmarks(int landmarks_count) {
+  vector<int> vertices(size());
+  for (int vertex = 0; vertex < size(); ++vertex) {
+    vertices[vertex] = vertex;
+  }
+  for (int i = 0; i < landmarks_count; ++i) {
+    std::swap(vertices[i], vertices[i + rand() % (size() - i)]);
+    add_landmark(vertices[i]);
+  }
+}
+
+void AltIndex::select_farthest_landmarks(int landmarks_count) {
+  if (landmarks_count == 0) {
+    return;
+  }
+  add_landmark(rand() % size());
+
+  // distance of vertex to landmarks set is min over landmarks of
+  // round trip distance, unreachable vertices are the farthest
+  vector<long long> distance_to_set(size(), 2LL * INFINITY);
+  while (landmarks_.size() < landmarks_count) {
+    int last = landmarks_.size() - 1;
+    int farthest_vertex = 0;
+    for (int vertex = 0; vertex < size(); ++vertex) {
+      long long round_trip =
+          static_cast<long long>(distance_from_landmark(last, vertex)) +
+          distance_to_landmark(last, vertex);
+      distance_to_set[vertex] = std::min(distance_to_set[vertex], round_trip);
+      if (distance_to_set[vertex] > distance_to_set[farthest_vertex]) {
+        farthest_vertex = vertex;
+      }
+    }
+    add_landmark(farthest_vertex);
+  }
+}
+
+namespace {
+
+// Dijkstra, which also returns shortest paths tree
+// and vertices in order of their settling
+void shortest_paths_tree(const Graph& graph,
+                         int root,
+                         vector<int>& distance,
+                         vector<int>& parent,
+                         vector<int>& settled_vertices) {
+  distance.assign(graph.size(), INFINITY);
+  parent.assign(graph.size(), -1);
+  settled_vertices.clear();
+
+  GraphKaryHeap<int, 4> active_vertices(graph.size());
+  vector<bool> settled(graph.size());
+  distance[root] = 0;
+  active_vertices.push(root, 0);
+
+  while (!active_vertices.empty()) {
+    int tail = active_vertices.top();
+    active_vertices.pop();
+    settled[tail] = true;
+    settled_vertices.push_back(tail);
+
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      int candidate_distance = distance[tail] + arc.weight;
+      if (!settled[arc.head] && distance[arc.head] > candidate_distance) {
+        if (distance[arc.head] == INFINITY) {
+          active_vertices.push(arc.head, candidate_distance);
+        } else {
+          active_vertices.decrease_key(arc.head, candidate_distance);
+        }
+        distance[arc.head] = candidate_distance;
+        parent[arc.head] = tail;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+void AltIndex::select_avoid_landmarks(int landmarks_count) {
+  if (landmarks_count == 0) {
+    return;
+  }
+  add_landmark(rand() % size());
+
+  vector<bool> is_landmark(size());
+  is_landmark[landmarks_[0]] = true;
+
+  while (landmarks_.size() < landmarks_count) {
+    int root = rand() % size();
+    vector<int> distance;
+    vector<int> parent;
+    vector<int> settled_vertices;
+    shortest_paths_tree(graph_, root, distance, parent, settled_vertices);
+
+    // weight of vertex is how much its lower bound is worse than
+    // real distance, size of vertex is total weight of its subtree,
+    // subtrees with landmarks are already well covered
+    vector<long long> subtree_size(size());
+    vector<bool> has_landmark(size());
+    for (int i = settled_vertices.size() - 1; i >= 0; --i) {
+      int vertex = settled_vertices[i];
+      if (is_landmark[vertex]) {
+        has_landmark[vertex] = true;
+      }
+      if (has_landmark[vertex]) {
+        subtree_size[vertex] = 0;
+      } else {
+        subtree_size[vertex] += distance[vertex] -
+            std::min(lower_bound(root, vertex), distance[vertex]);
+      }
+
+      if (parent[vertex] != -1) {
+        subtree_size[parent[vertex]] += subtree_size[vertex];
+        if (has_landmark[vertex]) {
+          has_landmark[parent[vertex]] = true;
+        }
+      }
+    }
+
+    // go down from root choosing the largest subtree
+    vector<int> best_child(size(), -1);
+    for (int i = 1; i < settled_vertices.size(); ++i) {
+      int vertex = settled_vertices[i];
+      int& child = best_child[parent[vertex]];
+      if (child == -1 || subtree_size[vertex] > subtree_size[child]) {
+        child = vertex;
+      }
+    }
+    int landmark = root;
+    while (best_child[landmark] != -1) {
+      landmark = best_child[landmark];
+    }
+
+    if (is_landmark[landmark]) {
+      // whole tree is covered, fall back to any new vertex
+      landmark = rand() % size();
+      if (is_landmark[landmark]) {
+        continue;
+      }
+    }
+    is_landmark[landmark] = true;
+    add_landmark(landmark);
+  }
+}
+
+void AltIndex::reset_query_buffers() {
+  distance_.assign(2, vector<int>(size(), INFINITY));
+  touched_vertices_.clear();
+  heaps_.assign(2, GraphKaryHeap<long long, 4>(size()));
+}
+
+int AltIndex::query(int source, int destination) {
+  assert(source >= 0 && source < size());
+  assert(destination >= 0 && destination < size());
+
+  settled_vertices_count_ = 0;
+  int shortest_path = INFINITY;
+  vector<int>& distance = distance_[0];
+  GraphKaryHeap<long long, 4>& active_vertices = heaps_[0];
+
+  if (lower_bound(source, destination) != INFINITY) {
+    distance[source] = 0;
+    touched_vertices_.push_back(source);
+    active_vertices.push(source, lower_bound(source, destination));
+  }
+
+  while (!active_vertices.empty()) {
+    int tail = active_vertices.top();
+    active_vertices.pop();
+    ++settled_vertices_count_;
+
+    if (tail == destination) {
+      shortest_path = distance[tail];
+      break;
+    }
+
+    for (int arc_index = 0; arc_index < graph_[tail].size(); ++arc_index) {
+      const Arc& arc = graph_[tail][arc_index];
+      int candidate_distance = distance[tail] + arc.weight;
+      if (distance[arc.head] > candidate_distance) {
+        int bound = lower_bound(arc.head, destination);
+        if (bound == INFINITY) {
+          continue;
+        }
+
+        if (distance[arc.head] == INFINITY) {
+          touched_vertices_.push_back(arc.head);
+          active_vertices.push(arc.head,
+                               static_cast<long long>(candidate_distance) +
+                               bound);
+        } else {
+          active_vertices.decrease_key(
+              arc.head, static_cast<long long>(candidate_distance) + bound);
+        }
+        distance[arc.head] = candidate_distance;
+      }
+    }
+  }
+
+  for (int i = 0; i < touched_vertices_.size(); ++i) {
+    distance[touched_vertices_[i]] = INFINITY;
+  }
+  touched_vertices_.clear();
+  active_vertices.clear();
+
+  return shortest_path;
+}
+
+// Both searches use average potential p(v) = (pi_t(v) - pi_s(v)) / 2,
+// where pi_t(v) bounds d(v, destination) and pi_s(v) bounds d(source, v),
+// forward search uses p, backward search uses -p, so that both
+// run on the same graph of reduced arc weights. Keys are doubled
+// to keep them integer.
+int AltIndex::bidirectional_query(int source, int destination) {
+  assert(source >= 0 && source < size());
+  assert(destination >= 0 && destination < size());
+
+  settled_vertices_count_ = 0;
+  int shortest_path = INFINITY;
+  const int terminals[] = {source, destination};
+  const Graph* graphs[] = {&graph_, &inverted_graph_};
+
+  if (lower_bound(source, destination) != INFINITY) {
+    for (int direction = 0; direction < 2; ++direction) {
+      int terminal = terminals[direction];
+      long long potential = static_cast<long long>(
+          lower_bound(terminal, destination)) - lower_bound(source, terminal);
+      distance_[direction][terminal] = 0;
+      touched_vertices_.push_back(terminal);
+      heaps_[direction].push(terminal,
+                             direction == 0 ? potential : -potential);
+    }
+  }
+
+  while (!heaps_[0].empty() && !heaps_[1].empty()) {
+    long long forward_key = heaps_[0].get(heaps_[0].top());
+    long long backward_key = heaps_[1].get(heaps_[1].top());
+    if (shortest_path != INFINITY &&
+        forward_key + backward_key >= 2LL * shortest_path) {
+      break;
+    }
+
+    int direction = forward_key <= backward_key ? 0 : 1;
+    const Graph& graph = *graphs[direction];
+    vector<int>& distance = distance_[direction];
+    const vector<int>& other_distance = distance_[1 - direction];
+    GraphKaryHeap<long long, 4>& active_vertices = heaps_[direction];
+
+    int tail = active_vertices.top();
+    active_vertices.pop();
+    ++settled_vertices_count_;
+
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      int candidate_distance = distance[tail] + arc.weight;
+      if (distance[arc.head] > candidate_distance) {
+        int bound_to_destination = lower_bound(arc.head, destination);
+        int bound_from_source = lower_bound(source, arc.head);
+        if (bound_to_destination == INFINITY ||
+            bound_from_source == INFINITY) {
+          continue;
+        }
+
+        long long potential =
+            static_cast<long long>(bound_to_destination) - bound_from_source;
+        long long key = 2LL * candidate_distance +
+            (direction == 0 ? potential : -potential);
+        if (distance[arc.head] == INFINITY &&
+            other_distance[arc.head] == INFINITY) {
+          touched_vertices_.push_back(arc.head);
+        }
+        if (distance[arc.head] == INFINITY) {
+          active_vertices.push(arc.head, key);
+        } else {
+          active_vertices.decrease_key(arc.head, key);
+        }
+        distance[arc.head] = candidate_distance;
+
+        if (other_distance[arc.head] != INFINITY) {
+          shortest_path = std::min(shortest_path,
+                                   candidate_distance +
+                                   other_distance[arc.head]);
+        }
+      }
+    }
+  }
+
+  if (source == destination) {
+    shortest_path = 0;
+  }
+
+  for (int i = 0; i < touched_vertices_.size(); ++i) {
+    distance_[0][touched_vertices_[i]] = INFINITY;
+    distance_[1][touched_vertices_[i]] = INFINITY;
+  }
+  touched_vertices_.clear();
+  heaps_[0].clear();
+  heaps_[1].clear();
+
+  return shortest_path;
+}
@@ -47,11 +47,12 @@ Graph generate_random_graph(long long vertices_count, long long arcs_count) {
   Graph graph(vertices_count);
 
   for (int arc_index = 0; arc_index < arcs_count; ++arc_index) {
-    long long arc_code, tail, head;
+    // ends are drawn separately, code of arc as one rand() number
+    // would not reach tails above RAND_MAX / vertices_count
+    long long tail, head;
     do {
-      arc_code = ((long long)rand()) % (vertices_count * vertices_count);
-      tail = arc_code / vertices_count;
-      head = arc_code % vertices_count;
+      tail = rand() % vertices_count;
+      head = rand() % vertices_count;
     } while (tail == head);
 
     int weight = rand() % MAX_WEIGHT;
@@ -0,0 +1,215 @@
+#include "graph/components.h"
+
+#include <vector>
+#include <cassert>
+#include <algorithm>
+
+#include "basic/dsu.h"
+#include "graph/common.h"
+#include "graph/threads.h"
+
+using std::vector;
+
+// threads take tails by chunks of this size
+const int COMPONENTS_CHUNK_SIZE = 1024;
+
+// replaces roots by numbers of components in order of first vertices
+int number_components(vector<int>& component) {
+  vector<int> number(component.size(), -1);
+  int components_count = 0;
+  for (int vertex = 0; vertex < component.size(); ++vertex) {
+    int& root_number = number[component[vertex]];
+    if (root_number == -1) {
+      root_number = components_count++;
+    }
+    component[vertex] = root_number;
+  }
+  return components_count;
+}
+
+int connected_components(const Graph& graph, vector<int>& component) {
+  DisjointSetUnion dsu(graph.size());
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      dsu.unite(tail, graph[tail][arc_index].head);
+    }
+  }
+
+  component.resize(graph.size());
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    component[vertex] = dsu.get_root(vertex);
+  }
+  int components_count = number_components(component);
+  assert(components_count == dsu.get_components_count());
+  return components_count;
+}
+
+// First run unites ends of all arcs, second one finds roots
+// of all vertices, both take chunks of vertices one by one.
+class ParallelComponents {
+ public:
+  ParallelComponents(const Graph& graph, vector<int>& component)
+      : graph_(graph),
+        component_(component),
+        dsu_(graph.size()),
+        next_vertex_(0),
+        find_roots_(false)
+    { }
+
+  void run(int thread_index);
+  void start_finding_roots() {
+    next_vertex_ = 0;
+    find_roots_ = true;
+  }
+  int get_components_count() const { return dsu_.get_components_count(); }
+ private:
+  const Graph& graph_;
+  vector<int>& component_;
+  ConcurrentDisjointSetUnion dsu_;
+  int next_vertex_;
+  bool find_roots_;
+};
+
+void ParallelComponents::run(int thread_index) {
+  while (true) {
+    int begin = __sync_fetch_and_add(&next_vertex_, COMPONENTS_CHUNK_SIZE);
+    if (begin >= graph_.size()) {
+      break;
+    }
+    int end = std::min<int>(begin + COMPONENTS_CHUNK_SIZE, graph_.size());
+
+    for (int tail = begin; tail < end; ++tail) {
+      if (find_roots_) {
+        component_[tail] = dsu_.get_root(tail);
+        continue;
+      }
+      for (int arc_index = 0; arc_index < graph_[tail].size(); ++arc_index) {
+        dsu_.unite(tail, graph_[tail][arc_index].head);
+      }
+    }
+  }
+}
+
+int connected_components(const Graph& graph,
+                         vector<int>& component,
+                         int threads_count) {
+  component.resize(graph.size());
+  ParallelComponents parallel_components(graph, component);
+  run_in_threads(parallel_components, threads_count);
+  parallel_components.start_finding_roots();
+  run_in_threads(parallel_components, threads_count);
+
+  int components_count = number_components(component);
+  assert(components_count == parallel_components.get_components_count());
+  return components_count;
+}
+
+int strongly_connected_components(const Graph& graph,
+                                  vector<int>& component) {
+  vector<int> index(graph.size(), -1);
+  vector<int> low_link(graph.size());
+  vector<int> component_stack;
+  // depth first search stack of vertices with their next arcs
+  vector< std::pair<int, int> > call_stack;
+  int next_index = 0;
+  int components_count = 0;
+
+  component.assign(graph.size(), -1);
+  for (int root = 0; root < graph.size(); ++root) {
+    if (index[root] != -1) {
+      continue;
+    }
+    index[root] = low_link[root] = next_index++;
+    component_stack.push_back(root);
+    call_stack.push_back(std::make_pair(root, 0));
+
+    while (!call_stack.empty()) {
+      int vertex = call_stack.back().first;
+      int& arc_index = call_stack.back().second;
+      if (arc_index < graph[vertex].size()) {
+        int head = graph[vertex][arc_index++].head;
+        if (index[head] == -1) {
+          index[head] = low_link[head] = next_index++;
+          component_stack.push_back(head);
+          call_stack.push_back(std::make_pair(head, 0));
+        } else if (component[head] == -1) {
+          // head is still in component stack
+          low_link[vertex] = std::min(low_link[vertex], index[head]);
+        }
+        continue;
+      }
+
+      call_stack.pop_back();
+      if (low_link[vertex] == index[vertex]) {
+        int member;
+        do {
+          member = component_stack.back();
+          component_stack.pop_back();
+          component[member] = components_count;
+        } while (member != vertex);
+        ++components_count;
+      }
+      if (!call_stack.empty()) {
+        int parent = call_stack.back().first;
+        low_link[parent] = std::min(low_link[parent], low_link[vertex]);
+      }
+    }
+  }
+
+  // Tarjan's algorithm finds components in reverse topological order
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    component[vertex] = components_count - 1 - component[vertex];
+  }
+  return components_count;
+}
+
+void group_by_components(const vector<int>& component,
+                         int components_count,
+                         vector<int>& offsets,
+                         vector<int>& vertices) {
+  offsets.assign(components_count + 1, 0);
+  for (int vertex = 0; vertex < component.size(); ++vertex) {
+    ++offsets[component[vertex] + 1];
+  }
+  for (int i = 0; i < components_count; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+  vertices.resize(component.size());
+  vector<int> next_position(offsets.begin(), offsets.end() - 1);
+  for (int vertex = 0; vertex < component.size(); ++vertex) {
+    vertices[next_position[component[vertex]]++] = vertex;
+  }
+}
+
+Graph condensation(const Graph& graph,
+                   const vector<int>& component,
+                   int components_count) {
+  Graph dag(components_count);
+  // position of arc to component in adjacency list of current tail
+  vector<int> arc_position(components_count, -1);
+  vector<int> offsets;
+  vector<int> vertices;
+  group_by_components(component, components_count, offsets, vertices);
+
+  for (int tail = 0; tail < components_count; ++tail) {
+    for (int i = offsets[tail]; i < offsets[tail + 1]; ++i) {
+      const vector<Arc>& arcs = graph[vertices[i]];
+      for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+        int head = component[arcs[arc_index].head];
+        if (head == tail) {
+          continue;
+        }
+        int& position = arc_position[head];
+        if (position == -1 || position >= dag[tail].size() ||
+            dag[tail][position].head != head) {
+          position = dag[tail].size();
+          dag[tail].push_back(Arc(head, arcs[arc_index].weight));
+        } else {
+          dag[tail][position].weight = std::min(dag[tail][position].weight,
+                                                arcs[arc_index].weight);
+        }
+      }
+    }
+  }
+  return dag;
+}
@@ -0,0 +1,520 @@
+#include "graph/contraction_hierarchy.h"
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+#include <cassert>
+
+#include "graph/common.h"
+#include "graph/heap.h"
+
+using std::vector;
+using std::string;
+
+// witness search gives up after settling this many vertices,
+// which may only add superfluous shortcuts; importance estimation
+// runs much more often, so it uses a smaller limit
+const int MAX_WITNESS_SETTLED_COUNT = 1000;
+const int MAX_ESTIMATION_WITNESS_SETTLED_COUNT = 50;
+
+// Contracts vertices of working graph, which keeps only arcs
+// between not yet contracted vertices. Vertex importance is
+// edge difference plus count of contracted neighbors,
+// it is updated lazily when vertex is taken from queue.
+class Contractor {
+ public:
+  explicit Contractor(const Graph& graph);
+
+  void run(vector<int>& rank, Graph& upward_graph, Graph& downward_graph);
+ private:
+  int contract(int vertex, bool simulate);
+  int importance(int vertex);
+  void witness_search(int source, int avoided, int max_distance,
+                      int max_settled_count);
+  void add_arc(int tail, int head, int weight);
+  void remove_arc(vector<Arc>& arcs, int head);
+
+  int vertices_count_;
+  Graph out_arcs_;
+  Graph in_arcs_;
+  vector<int> contracted_neighbors_count_;
+
+  vector<int> witness_distance_;
+  vector<int> witness_touched_;
+  GraphKaryHeap<int, 4> witness_heap_;
+};
+
+Contractor::Contractor(const Graph& graph)
+    : vertices_count_(graph.size()),
+      out_arcs_(graph.size()),
+      in_arcs_(graph.size()),
+      contracted_neighbors_count_(graph.size()),
+      witness_distance_(graph.size(), INFINITY),
+      witness_heap_(graph.size()) {
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      if (arc.head != tail) {
+        add_arc(tail, arc.head, arc.weight);
+      }
+    }
+  }
+}
+
+// keeps single arc of min weight between pair of vertices
+void Contractor::add_arc(int tail, int head, int weight) {
+  for (int arc_index = 0; arc_index < out_arcs_[tail].size(); ++arc_index) {
+    Arc& arc = out_arcs_[tail][arc_index];
+    if (arc.head == head) {
+      if (arc.weight > weight) {
+        arc.weight = weight;
+        for (int i = 0; i < in_arcs_[head].size(); ++i) {
+          if (in_arcs_[head][i].head == tail) {
+            in_arcs_[head][i].weight = weight;
+          }
+        }
+      }
+      return;
+    }
+  }
+  out_arcs_[tail].push_back(Arc(head, weight));
+  in_arcs_[head].push_back(Arc(tail, weight));
+}
+
+void Contractor::remove_arc(vector<Arc>& arcs, int head) {
+  for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+    if (arcs[arc_index].head == head) {
+      arcs[arc_index] = arcs.back();
+      arcs.pop_back();
+      return;
+    }
+  }
+}
+
+void Contractor::witness_search(int source, int avoided, int max_distance,
+                                int max_settled_count) {
+  for (int i = 0; i < witness_touched_.size(); ++i) {
+    witness_distance_[witness_touched_[i]] = INFINITY;
+  }
+  witness_touched_.clear();
+  witness_heap_.clear();
+
+  witness_distance_[source] = 0;
+  witness_touched_.push_back(source);
+  witness_heap_.push(source, 0);
+
+  int settled_count = 0;
+  while (!witness_heap_.empty() && settled_count < max_settled_count) {
+    int tail = witness_heap_.top();
+    witness_heap_.pop();
+    if (witness_distance_[tail] > max_distance) {
+      break;
+    }
+    ++settled_count;
+
+    for (int arc_index = 0; arc_index < out_arcs_[tail].size(); ++arc_index) {
+      const Arc& arc = out_arcs_[tail][arc_index];
+      int candidate_distance = witness_distance_[tail] + arc.weight;
+      if (arc.head != avoided &&
+          witness_distance_[arc.head] > candidate_distance) {
+        if (witness_distance_[arc.head] == INFINITY) {
+          witness_touched_.push_back(arc.head);
+          witness_distance_[arc.head] = candidate_distance;
+          witness_heap_.push(arc.head, candidate_distance);
+        } else {
+          witness_distance_[arc.head] = candidate_distance;
+          witness_heap_.decrease_key(arc.head, candidate_distance);
+        }
+      }
+    }
+  }
+}
+
+// returns count of shortcuts needed to contract vertex,
+// adds them unless simulate is set
+int Contractor::contract(int vertex, bool simulate) {
+  int max_out_weight = 0;
+  for (int arc_index = 0; arc_index < out_arcs_[vertex].size(); ++arc_index) {
+    max_out_weight = std::max(max_out_weight,
+                              out_arcs_[vertex][arc_index].weight);
+  }
+
+  vector<Arc> shortcuts;
+  vector<int> shortcut_tails;
+  for (int in_index = 0; in_index < in_arcs_[vertex].size(); ++in_index) {
+    const Arc& in_arc = in_arcs_[vertex][in_index];
+    witness_search(in_arc.head, vertex, in_arc.weight + max_out_weight,
+                   simulate ? MAX_ESTIMATION_WITNESS_SETTLED_COUNT
+                            : MAX_WITNESS_SETTLED_COUNT);
+
+    for (int out_index = 0;
+         out_index < out_arcs_[vertex].size();
+         ++out_index) {
+      const Arc& out_arc = out_arcs_[vertex][out_index];
+      int path_weight = in_arc.weight + out_arc.weight;
+      if (out_arc.head != in_arc.head &&
+          witness_distance_[out_arc.head] > path_weight) {
+        shortcuts.push_back(Arc(out_arc.head, path_weight));
+        shortcut_tails.push_back(in_arc.head);
+      }
+    }
+  }
+
+  if (!simulate) {
+    for (int i = 0; i < shortcuts.size(); ++i) {
+      add_arc(shortcut_tails[i], shortcuts[i].head, shortcuts[i].weight);
+    }
+  }
+
+  return shortcuts.size();
+}
+
+int Contractor::importance(int vertex) {
+  return contract(vertex, true) -
+      static_cast<int>(in_arcs_[vertex].size() + out_arcs_[vertex].size()) +
+      contracted_neighbors_count_[vertex];
+}
+
+void Contractor::run(vector<int>& rank,
+                     Graph& upward_graph,
+                     Graph& downward_graph) {
+  rank.assign(vertices_count_, -1);
+  upward_graph.assign(vertices_count_, vector<Arc>());
+  downward_graph.assign(vertices_count_, vector<Arc>());
+
+  GraphKaryHeap<int, 4> queue(vertices_count_);
+  for (int vertex = 0; vertex < vertices_count_; ++vertex) {
+    queue.push(vertex, importance(vertex));
+  }
+
+  for (int order = 0; order < vertices_count_; ++order) {
+    int vertex = queue.top();
+    queue.pop();
+
+    // lazy update: put vertex back if it is not the least important
+    int actual_importance = importance(vertex);
+    while (!queue.empty() && actual_importance > queue.get(queue.top())) {
+      queue.push(vertex, actual_importance);
+      vertex = queue.top();
+      queue.pop();
+      actual_importance = importance(vertex);
+    }
+
+    contract(vertex, false);
+    rank[vertex] = order;
+    upward_graph[vertex] = out_arcs_[vertex];
+    downward_graph[vertex] = in_arcs_[vertex];
+
+    for (int arc_index = 0; arc_index < out_arcs_[vertex].size(); ++arc_index) {
+      int head = out_arcs_[vertex][arc_index].head;
+      remove_arc(in_arcs_[head], vertex);
+      ++contracted_neighbors_count_[head];
+    }
+    for (int arc_index = 0; arc_index < in_arcs_[vertex].size(); ++arc_index) {
+      int tail = in_arcs_[vertex][arc_index].head;
+      remove_arc(out_arcs_[tail], vertex);
+      ++contracted_neighbors_count_[tail];
+    }
+    vector<Arc>().swap(out_arcs_[vertex]);
+    vector<Arc>().swap(in_arcs_[vertex]);
+  }
+}
+
+ContractionHierarchy::ContractionHierarchy()
+    : forward_heap_(0),
+      backward_heap_(0)
+  { }
+
+ContractionHierarchy::ContractionHierarchy(const Graph& graph)
+    : forward_heap_(0),
+      backward_heap_(0) {
+  contract(graph);
+}
+
+void ContractionHierarchy::contract(const Graph& graph) {
+  Contractor contractor(graph);
+  contractor.run(rank_, upward_graph_, downward_graph_);
+  reset_query_buffers();
+}
+
+void ContractionHierarchy::reset_query_buffers() {
+  forward_distance_.assign(size(), INFINITY);
+  backward_distance_.assign(size(), INFINITY);
+  touched_vertices_.clear();
+  forward_heap_ = GraphKaryHeap<int, 4>(size());
+  backward_heap_ = GraphKaryHeap<int, 4>(size());
+}
+
+int ContractionHierarchy::query(int source, int destination) {
+  assert(source >= 0 && source < size());
+  assert(destination >= 0 && destination < size());
+
+  forward_distance_[source] = 0;
+  backward_distance_[destination] = 0;
+  touched_vertices_.push_back(source);
+  touched_vertices_.push_back(destination);
+  forward_heap_.push(source, 0);
+  backward_heap_.push(destination, 0);
+
+  int shortest_path = INFINITY;
+  while (true) {
+    bool forward_active = !forward_heap_.empty() &&
+        forward_heap_.get(forward_heap_.top()) < shortest_path;
+    bool backward_active = !backward_heap_.empty() &&
+        backward_heap_.get(backward_heap_.top()) < shortest_path;
+    if (!forward_active && !backward_active) {
+      break;
+    }
+
+    bool forward = forward_active &&
+        (!backward_active ||
+         forward_heap_.get(forward_heap_.top()) <=
+         backward_heap_.get(backward_heap_.top()));
+
+    const Graph& graph = forward ? upward_graph_ : downward_graph_;
+    GraphKaryHeap<int, 4>& heap = forward ? forward_heap_ : backward_heap_;
+    vector<int>& distance = forward ? forward_distance_ : backward_distance_;
+    const vector<int>& other_distance =
+        forward ? backward_distance_ : forward_distance_;
+
+    int tail = heap.top();
+    heap.pop();
+    if (other_distance[tail] != INFINITY) {
+      shortest_path = std::min(shortest_path,
+                               distance[tail] + other_distance[tail]);
+    }
+
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      int candidate_distance = distance[tail] + arc.weight;
+      if (distance[arc.head] > candidate_distance) {
+        if (distance[arc.head] == INFINITY) {
+          touched_vertices_.push_back(arc.head);
+          distance[arc.head] = candidate_distance;
+          heap.push(arc.head, candidate_distance);
+        } else {
+          distance[arc.head] = candidate_distance;
+          heap.decrease_key(arc.head, candidate_distance);
+        }
+      }
+    }
+  }
+
+  for (int i = 0; i < touched_vertices_.size(); ++i) {
+    forward_distance_[touched_vertices_[i]] = INFINITY;
+    backward_distance_[touched_vertices_[i]] = INFINITY;
+  }
+  touched_vertices_.clear();
+  forward_heap_.clear();
+  backward_heap_.clear();
+
+  return shortest_path;
+}
+
+void ContractionHierarchy::upward_search(const Graph& graph, int root) {
+  forward_distance_[root] = 0;
+  touched_vertices_.push_back(root);
+  forward_heap_.push(root, 0);
+
+  while (!forward_heap_.empty()) {
+    int tail = forward_heap_.top();
+    forward_heap_.pop();
+
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      int candidate_distance = forward_distance_[tail] + arc.weight;
+      if (forward_distance_[arc.head] > candidate_distance) {
+        if (forward_distance_[arc.head] == INFINITY) {
+          touched_vertices_.push_back(arc.head);
+          forward_heap_.push(arc.head, candidate_distance);
+        } else {
+          forward_heap_.decrease_key(arc.head, candidate_distance);
+        }
+        forward_distance_[arc.head] = candidate_distance;
+      }
+    }
+  }
+}
+
+void ContractionHierarchy::distance_table(const vector<int>& sources,
+                                          const vector<int>& targets,
+                                          vector<int>& table) {
+  table.assign(sources.size() * targets.size(), INFINITY);
+
+  // bucket of vertex keeps (target index, distance to target) pairs,
+  // buckets are stored contiguously in order of vertices
+  vector< std::pair<int, int> > entries;
+  vector<int> entry_vertices;
+  for (int target_index = 0; target_index < targets.size(); ++target_index) {
+    upward_search(downward_graph_, targets[target_index]);
+    for (int i = 0; i < touched_vertices_.size(); ++i) {
+      int vertex = touched_vertices_[i];
+      entries.push_back(std::make_pair(target_index,
+                                       forward_distance_[vertex]));
+      entry_vertices.push_back(vertex);
+      forward_distance_[vertex] = INFINITY;
+    }
+    touched_vertices_.clear();
+  }
+
+  vector<int> bucket_begin(size() + 1, 0);
+  for (int i = 0; i < entry_vertices.size(); ++i) {
+    ++bucket_begin[entry_vertices[i] + 1];
+  }
+  for (int vertex = 0; vertex < size(); ++vertex) {
+    bucket_begin[vertex + 1] += bucket_begin[vertex];
+  }
+  vector< std::pair<int, int> > buckets(entries.size());
+  vector<int> bucket_end(bucket_begin.begin(), bucket_begin.end() - 1);
+  for (int i = 0; i < entries.size(); ++i) {
+    buckets[bucket_end[entry_vertices[i]]++] = entries[i];
+  }
+
+  for (int source_index = 0; source_index < sources.size(); ++source_index) {
+    upward_search(upward_graph_, sources[source_index]);
+    int* row = &table[source_index * targets.size()];
+    for (int i = 0; i < touched_vertices_.size(); ++i) {
+      int vertex = touched_vertices_[i];
+      for (int entry = bucket_begin[vertex];
+           entry < bucket_begin[vertex + 1];
+           ++entry) {
+        int& shortest_path = row[buckets[entry].first];
+        shortest_path = std::min(shortest_path,
+                                 forward_distance_[vertex] +
+                                 buckets[entry].second);
+      }
+      forward_distance_[vertex] = INFINITY;
+    }
+    touched_vertices_.clear();
+  }
+}
+
+namespace {
+
+const uint32_t CONTRACTION_HIERARCHY_MAGIC = 0x48434254;  // "TBCH"
+const uint32_t CONTRACTION_HIERARCHY_VERSION = 1;
+const long long UINT32_SIZE = sizeof(uint32_t);
+
+void write_uint32(std::ostream& out, uint32_t value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+uint32_t read_uint32(std::istream& in) {
+  uint32_t value = 0;
+  in.read(reinterpret_cast<char*>(&value), sizeof(value));
+  return value;
+}
+
+void write_graph(std::ostream& out, const Graph& graph) {
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    write_uint32(out, graph[tail].size());
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      write_uint32(out, graph[tail][arc_index].head);
+      write_uint32(out, graph[tail][arc_index].weight);
+    }
+  }
+}
+
+// bytes_left is size of unread rest of file, returns false
+// if arcs don't fit into it or some head is not a vertex
+bool read_graph(std::istream& in,
+                int vertices_count,
+                long long& bytes_left,
+                Graph& graph) {
+  graph.assign(vertices_count, vector<Arc>());
+  for (int tail = 0; tail < vertices_count && in; ++tail) {
+    uint32_t arcs_count = read_uint32(in);
+    bytes_left -= UINT32_SIZE;
+    if (arcs_count > bytes_left / (2 * UINT32_SIZE)) {
+      return false;
+    }
+    bytes_left -= 2 * UINT32_SIZE * arcs_count;
+
+    graph[tail].resize(arcs_count);
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      uint32_t head = read_uint32(in);
+      if (head >= vertices_count) {
+        return false;
+      }
+      graph[tail][arc_index].head = head;
+      graph[tail][arc_index].weight = read_uint32(in);
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+void ContractionHierarchy::save(const string& filename) const {
+  std::ofstream out(filename.c_str(), std::ios::binary);
+  if (!out.is_open()) {
+    throw std::runtime_error(filename + " can't be opened for write");
+  }
+
+  write_uint32(out, CONTRACTION_HIERARCHY_MAGIC);
+  write_uint32(out, CONTRACTION_HIERARCHY_VERSION);
+  write_uint32(out, size());
+  for (int vertex = 0; vertex < size(); ++vertex) {
+    write_uint32(out, rank_[vertex]);
+  }
+  write_graph(out, upward_graph_);
+  write_graph(out, downward_graph_);
+
+  if (!out) {
+    throw std::runtime_error(filename + " can't write file");
+  }
+}
+
+void ContractionHierarchy::load(const string& filename) {
+  std::ifstream in(filename.c_str(), std::ios::binary);
+  if (!in.is_open()) {
+    throw std::runtime_error(filename + " can't be opened for read");
+  }
+
+  if (read_uint32(in) != CONTRACTION_HIERARCHY_MAGIC) {
+    throw std::runtime_error(filename + " is not contraction hierarchy");
+  }
+  if (read_uint32(in) != CONTRACTION_HIERARCHY_VERSION) {
+    throw std::runtime_error(filename + " has unsupported version");
+  }
+
+  // counts are bounded by file size before anything is allocated,
+  // every vertex takes at least rank and two arcs counts
+  in.seekg(0, std::ios::end);
+  long long bytes_left = static_cast<long long>(in.tellg()) - 3 * UINT32_SIZE;
+  in.seekg(2 * UINT32_SIZE);
+  uint32_t vertices_count = read_uint32(in);
+  if (!in || vertices_count > bytes_left / (3 * UINT32_SIZE)) {
+    throw std::runtime_error(filename + " has wrong size");
+  }
+  bytes_left -= UINT32_SIZE * vertices_count;
+
+  // hierarchy is left untouched if file is broken
+  vector<int> rank(vertices_count);
+  for (int vertex = 0; vertex < vertices_count && in; ++vertex) {
+    uint32_t vertex_rank = read_uint32(in);
+    if (vertex_rank >= vertices_count) {
+      throw std::runtime_error(filename + " has wrong ranks");
+    }
+    rank[vertex] = vertex_rank;
+  }
+  Graph upward_graph;
+  Graph downward_graph;
+  if (!read_graph(in, vertices_count, bytes_left, upward_graph) ||
+      !read_graph(in, vertices_count, bytes_left, downward_graph)) {
+    throw std::runtime_error(filename + " has wrong arcs");
+  }
+
+  if (!in) {
+    throw std::runtime_error(filename + " can't read file");
+  }
+  rank_.swap(rank);
+  upward_graph_.swap(upward_graph);
+  downward_graph_.swap(downward_graph);
+  reset_query_buffers();
+}
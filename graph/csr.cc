@@ -0,0 +1,109 @@
+#include "graph/csr.h"
+
+#include <vector>
+#include <cassert>
+#include <cstddef>
+
+#include "graph/common.h"
+
+using std::vector;
+
+CsrGraph::CsrGraph()
+    : offsets_storage_(1, 0) {
+  point_to_storage();
+}
+
+CsrGraph::CsrGraph(const Graph& graph)
+    : offsets_storage_(graph.size() + 1, 0) {
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    offsets_storage_[tail + 1] = offsets_storage_[tail] + graph[tail].size();
+  }
+
+  heads_storage_.resize(offsets_storage_[graph.size()]);
+  weights_storage_.resize(offsets_storage_[graph.size()]);
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      heads_storage_[offsets_storage_[tail] + arc_index] = arc.head;
+      weights_storage_[offsets_storage_[tail] + arc_index] = arc.weight;
+    }
+  }
+  point_to_storage();
+}
+
+CsrGraph::CsrGraph(const vector<int>& offsets,
+                   const vector<int>& heads,
+                   const vector<int>& weights)
+    : offsets_storage_(offsets),
+      heads_storage_(heads),
+      weights_storage_(weights) {
+  assert(!offsets_storage_.empty());
+  assert(offsets_storage_.back() == heads_storage_.size());
+  assert(heads_storage_.size() == weights_storage_.size());
+  point_to_storage();
+}
+
+CsrGraph::CsrGraph(int vertices_count,
+                   const int* offsets,
+                   const int* heads,
+                   const int* weights)
+    : size_(vertices_count),
+      owns_arrays_(false),
+      offsets_(offsets),
+      heads_(heads),
+      weights_(weights) {
+  assert(offsets[0] == 0);
+}
+
+CsrGraph::CsrGraph(const CsrGraph& other)
+    : size_(other.size_),
+      owns_arrays_(other.owns_arrays_),
+      offsets_(other.offsets_),
+      heads_(other.heads_),
+      weights_(other.weights_),
+      offsets_storage_(other.offsets_storage_),
+      heads_storage_(other.heads_storage_),
+      weights_storage_(other.weights_storage_) {
+  if (owns_arrays_) {
+    point_to_storage();
+  }
+}
+
+CsrGraph& CsrGraph::operator=(const CsrGraph& other) {
+  if (this != &other) {
+    size_ = other.size_;
+    owns_arrays_ = other.owns_arrays_;
+    offsets_ = other.offsets_;
+    heads_ = other.heads_;
+    weights_ = other.weights_;
+    offsets_storage_ = other.offsets_storage_;
+    heads_storage_ = other.heads_storage_;
+    weights_storage_ = other.weights_storage_;
+    if (owns_arrays_) {
+      point_to_storage();
+    }
+  }
+  return *this;
+}
+
+void CsrGraph::point_to_storage() {
+  size_ = offsets_storage_.size() - 1;
+  owns_arrays_ = true;
+  offsets_ = &offsets_storage_[0];
+  // arrays of graph without arcs have no elements to point to
+  heads_ = heads_storage_.empty() ? NULL : &heads_storage_[0];
+  weights_ = weights_storage_.empty() ? NULL : &weights_storage_[0];
+}
+
+Graph CsrGraph::to_graph() const {
+  Graph graph(size());
+  for (int tail = 0; tail < size(); ++tail) {
+    graph[tail].reserve(arcs_end(tail) - arcs_begin(tail));
+    for (int arc_index = arcs_begin(tail);
+         arc_index < arcs_end(tail);
+         ++arc_index) {
+      graph[tail].push_back(Arc(head(arc_index), weight(arc_index)));
+    }
+  }
+  return graph;
+}
@@ -0,0 +1,216 @@
+#include <pthread.h>
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include "graph/common.h"
+#include "graph/ssspp.h"
+#include "graph/threads.h"
+
+using std::vector;
+
+// All threads run the same loop separated by barriers:
+// thread 0 picks next set of vertices to relax (frontier),
+// then frontier is relaxed by all threads in parallel, then
+// thread 0 puts updated vertices into buckets.
+// Bucket i holds vertices with distance in [i * delta, (i + 1) * delta),
+// buckets are stored cyclicly, since all tentative distances lie
+// within max_weight from current bucket.
+class DeltaStepping {
+ public:
+  DeltaStepping(const Graph& graph,
+                int source,
+                int delta,
+                int threads_count,
+                vector<int>& distance);
+  ~DeltaStepping();
+
+  void run(int thread_index);
+ private:
+  void relax(int thread_index);
+  void prepare_frontier();
+  void extract_current_bucket();
+  bool advance_to_next_bucket();
+  void distribute_updated_vertices();
+
+  const Graph& graph_;
+  int delta_;
+  int threads_count_;
+  vector<int>& distance_;
+
+  vector< vector<int> > buckets_;
+  long long current_bucket_;
+
+  vector<int> frontier_;
+  vector<int> frontier_stamp_;
+  int stamp_;
+  bool relax_light_arcs_;
+
+  // vertices settled in current bucket, their heavy arcs
+  // are relaxed when bucket becomes empty
+  vector<int> settled_;
+  vector<long long> settled_bucket_;
+
+  vector< vector<int> > updated_vertices_;
+  bool done_;
+
+  pthread_barrier_t barrier_;
+};
+
+DeltaStepping::DeltaStepping(const Graph& graph,
+                             int source,
+                             int delta,
+                             int threads_count,
+                             vector<int>& distance)
+    : graph_(graph),
+      delta_(delta),
+      threads_count_(threads_count),
+      distance_(distance),
+      current_bucket_(0),
+      frontier_stamp_(graph.size(), 0),
+      stamp_(0),
+      relax_light_arcs_(true),
+      settled_bucket_(graph.size(), -1),
+      updated_vertices_(threads_count),
+      done_(false) {
+  assert(delta > 0);
+  assert(threads_count > 0);
+
+  int max_weight = 0;
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      max_weight = std::max(max_weight, graph[tail][arc_index].weight);
+    }
+  }
+  buckets_.resize(max_weight / delta + 2);
+
+  distance_.assign(graph.size(), INFINITY);
+  distance_[source] = 0;
+  buckets_[0].push_back(source);
+
+  pthread_barrier_init(&barrier_, NULL, threads_count);
+}
+
+DeltaStepping::~DeltaStepping() {
+  pthread_barrier_destroy(&barrier_);
+}
+
+void DeltaStepping::run(int thread_index) {
+  while (true) {
+    if (thread_index == 0) {
+      prepare_frontier();
+    }
+    pthread_barrier_wait(&barrier_);
+
+    if (done_) {
+      break;
+    }
+
+    relax(thread_index);
+    pthread_barrier_wait(&barrier_);
+
+    if (thread_index == 0) {
+      distribute_updated_vertices();
+    }
+  }
+}
+
+void DeltaStepping::relax(int thread_index) {
+  vector<int>& updated_vertices = updated_vertices_[thread_index];
+  for (int frontier_index = thread_index;
+       frontier_index < frontier_.size();
+       frontier_index += threads_count_) {
+    int tail = frontier_[frontier_index];
+    int tail_distance = distance_[tail];
+    for (int arc_index = 0; arc_index < graph_[tail].size(); ++arc_index) {
+      const Arc& arc = graph_[tail][arc_index];
+      if ((arc.weight <= delta_) == relax_light_arcs_ &&
+          atomic_min(&distance_[arc.head], tail_distance + arc.weight)) {
+        updated_vertices.push_back(arc.head);
+      }
+    }
+  }
+}
+
+void DeltaStepping::extract_current_bucket() {
+  ++stamp_;
+  vector<int> bucket;
+  bucket.swap(buckets_[current_bucket_ % buckets_.size()]);
+  for (int i = 0; i < bucket.size(); ++i) {
+    int vertex = bucket[i];
+    // skip vertices, which were moved to lower bucket, and duplicates
+    if (distance_[vertex] / delta_ == current_bucket_ &&
+        frontier_stamp_[vertex] != stamp_) {
+      frontier_stamp_[vertex] = stamp_;
+      frontier_.push_back(vertex);
+      if (settled_bucket_[vertex] != current_bucket_) {
+        settled_bucket_[vertex] = current_bucket_;
+        settled_.push_back(vertex);
+      }
+    }
+  }
+}
+
+bool DeltaStepping::advance_to_next_bucket() {
+  for (int step = 1; step <= buckets_.size(); ++step) {
+    if (!buckets_[(current_bucket_ + step) % buckets_.size()].empty()) {
+      current_bucket_ += step;
+      return true;
+    }
+  }
+  return false;
+}
+
+void DeltaStepping::prepare_frontier() {
+  frontier_.clear();
+  while (true) {
+    extract_current_bucket();
+    if (!frontier_.empty()) {
+      relax_light_arcs_ = true;
+      return;
+    }
+
+    if (!settled_.empty()) {
+      frontier_.swap(settled_);
+      relax_light_arcs_ = false;
+      return;
+    }
+
+    if (!advance_to_next_bucket()) {
+      done_ = true;
+      return;
+    }
+  }
+}
+
+void DeltaStepping::distribute_updated_vertices() {
+  for (int thread_index = 0; thread_index < threads_count_; ++thread_index) {
+    vector<int>& updated_vertices = updated_vertices_[thread_index];
+    for (int i = 0; i < updated_vertices.size(); ++i) {
+      int vertex = updated_vertices[i];
+      buckets_[(distance_[vertex] / delta_) % buckets_.size()].push_back(
+          vertex);
+    }
+    updated_vertices.clear();
+  }
+}
+
+void delta_stepping(const Graph& graph,
+                    int source,
+                    vector<int>& distance,
+                    int delta,
+                    int threads_count) {
+  DeltaStepping delta_stepping(graph, source, delta, threads_count, distance);
+  run_in_threads(delta_stepping, threads_count);
+}
+
+int delta_stepping(const Graph& graph,
+                   int source,
+                   int destination,
+                   int delta,
+                   int threads_count) {
+  vector<int> distance;
+  delta_stepping(graph, source, distance, delta, threads_count);
+  return distance[destination];
+}
@@ -12,6 +12,7 @@
 #include "graph/ssspp.h"
 #include "graph/common.h"
 #include "graph/heap.h"
+#include "graph/shortest_path_workspace.h"
 
 using std::cout;
 using std::cin;
@@ -22,8 +23,11 @@ using std::set;
 using std::min;
 using std::swap;
 
-void dijkstra_on_array(const Graph& graph, int source,
-                       vector<int>& distance) {
+namespace {
+
+// settles vertices until destination, all of them if it is -1
+void dijkstra_on_array_until(const Graph& graph, int source, int destination,
+                             vector<int>& distance) {
   vector<int> color(graph.size(), WHITE);
   color[source] = GRAY;
 
@@ -49,6 +53,9 @@ void dijkstra_on_array(const Graph& graph, int source,
 
     // relax
     color[min_gray_vertex] = BLACK;
+    if (min_gray_vertex == destination) {
+      break;
+    }
     for (int arc_index = 0;
          arc_index < graph[min_gray_vertex].size();
          ++arc_index) {
@@ -62,6 +69,13 @@ void dijkstra_on_array(const Graph& graph, int source,
   }
 }
 
+}  // namespace
+
+void dijkstra_on_array(const Graph& graph, int source,
+                       vector<int>& distance) {
+  dijkstra_on_array_until(graph, source, -1, distance);
+}
+
 struct EstimatedVertex {
   int index;
   int distance;
@@ -104,8 +118,13 @@ std::ostream& operator<<(std::ostream& out, const EstimatedVertex& vertex) {
   return out;
 }
 
-void dijkstra_on_priority_queue(const Graph& graph, int source,
-                                vector<int>& distance) {
+namespace {
+
+// settles vertices until destination, all of them if it is -1
+void dijkstra_on_priority_queue_until(const Graph& graph,
+                                      int source,
+                                      int destination,
+                                      vector<int>& distance) {
   vector<int> color(graph.size(), WHITE);
   color[source] = GRAY;
 
@@ -135,6 +154,9 @@ void dijkstra_on_priority_queue(const Graph& graph, int source,
 
     // relax
     color[closest_active_vertex.index] = BLACK;
+    if (closest_active_vertex.index == destination) {
+      break;
+    }
     for (int arc_index = 0;
          arc_index < graph[closest_active_vertex.index].size();
          ++arc_index) {
@@ -149,50 +171,222 @@ void dijkstra_on_priority_queue(const Graph& graph, int source,
   }
 }
 
+}  // namespace
+
+void dijkstra_on_priority_queue(const Graph& graph, int source,
+                                vector<int>& distance) {
+  dijkstra_on_priority_queue_until(graph, source, -1, distance);
+}
+
 void dijkstra_on_set(const Graph& graph, int source,
                      vector<int>& distance) {
-  vector<int> color(graph.size(), WHITE);
-  color[source] = GRAY;
+  ShortestPathWorkspace workspace(graph.size());
+  dijkstra_on_set(graph, source, workspace);
+  workspace.get_distances(distance);
+}
 
-  distance.assign(graph.size(), INFINITY);
-  distance[source] = 0;
+namespace {
+
+// settles vertices until destination, all of them if it is -1
+void dijkstra_on_set_until(const Graph& graph, int source, int destination,
+                           ShortestPathWorkspace& workspace) {
+  workspace.reset(graph.size());
+  workspace.set_color(source, GRAY);
+  workspace.set_distance(source, 0);
 
   set<EstimatedVertex> active_vertices;
 
-  active_vertices.insert(EstimatedVertex(source, distance[source]));
+  active_vertices.insert(EstimatedVertex(source, 0));
 
   while (!active_vertices.empty()) {
     // find min
     EstimatedVertex closest_active_vertex = *active_vertices.begin();
     active_vertices.erase(active_vertices.begin());
 
-    // early terminate, not to do overflows
-    if (closest_active_vertex.distance == INFINITY) {
+    // relax
+    workspace.set_color(closest_active_vertex.index, BLACK);
+    if (closest_active_vertex.index == destination) {
       break;
     }
-
-    // relax
-    color[closest_active_vertex.index] = BLACK;
     for (int arc_index = 0;
          arc_index < graph[closest_active_vertex.index].size();
          ++arc_index) {
       const Arc& arc = graph[closest_active_vertex.index][arc_index];
-      if (color[arc.head] != BLACK &&
-          distance[arc.head] > closest_active_vertex.distance + arc.weight) {
-        if (color[arc.head] == WHITE) {
-          color[arc.head] = GRAY;
+      int candidate_distance = closest_active_vertex.distance + arc.weight;
+      if (workspace.color(arc.head) != BLACK &&
+          workspace.distance(arc.head) > candidate_distance) {
+        if (workspace.color(arc.head) == WHITE) {
+          workspace.set_color(arc.head, GRAY);
         } else {
           active_vertices.erase(active_vertices.find(
-              EstimatedVertex(arc.head, distance[arc.head])));
+              EstimatedVertex(arc.head, workspace.distance(arc.head))));
         }
-        distance[arc.head] = closest_active_vertex.distance + arc.weight;
-        active_vertices.insert(EstimatedVertex(arc.head, distance[arc.head]));
+        workspace.set_distance(arc.head, candidate_distance);
+        workspace.set_parent(arc.head, closest_active_vertex.index);
+        active_vertices.insert(EstimatedVertex(arc.head, candidate_distance));
+      }
+    }
+  }
+}
+
+
+// settles vertices until destination, all of them if it is -1
+void dijkstra_on_kary_heap_until(const Graph& graph,
+                                 int source,
+                                 int destination,
+                                 ShortestPathWorkspace& workspace) {
+  workspace.reset(graph.size());
+  workspace.set_color(source, GRAY);
+  workspace.set_distance(source, 0);
+
+  GraphKaryHeap<int, 4>& active_vertices = workspace.heap();
+  active_vertices.push(source, 0);
+
+  while (!active_vertices.empty()) {
+    // find min
+    int closest_active_vertex = active_vertices.top();
+    active_vertices.pop();
+
+    // relax
+    workspace.set_color(closest_active_vertex, BLACK);
+    if (closest_active_vertex == destination) {
+      break;
+    }
+    int closest_distance = workspace.distance(closest_active_vertex);
+    for (int arc_index = 0;
+         arc_index < graph[closest_active_vertex].size();
+         ++arc_index) {
+      const Arc& arc = graph[closest_active_vertex][arc_index];
+      int candidate_distance = closest_distance + arc.weight;
+      if (workspace.color(arc.head) != BLACK &&
+          workspace.distance(arc.head) > candidate_distance) {
+        if (workspace.color(arc.head) == WHITE) {
+          workspace.set_color(arc.head, GRAY);
+          active_vertices.push(arc.head, candidate_distance);
+        } else {
+          active_vertices.decrease_key(arc.head, candidate_distance);
+        }
+        workspace.set_distance(arc.head, candidate_distance);
+        workspace.set_parent(arc.head, closest_active_vertex);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+void dijkstra_on_set(const Graph& graph, int source,
+                     ShortestPathWorkspace& workspace) {
+  dijkstra_on_set_until(graph, source, -1, workspace);
+}
+
+void dijkstra_on_kary_heap(const Graph& graph, int source,
+                           ShortestPathWorkspace& workspace) {
+  dijkstra_on_kary_heap_until(graph, source, -1, workspace);
+}
+
+void dijkstra_on_radix_heap(const Graph& graph, int source,
+                            vector<int>& distance) {
+  GraphRadixHeap<int> active_vertices(graph.size());
+  dijkstra_on_graph_heap(graph, source, distance, active_vertices);
+}
+
+int max_arc_weight(const Graph& graph) {
+  int max_weight = 0;
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      max_weight = std::max(max_weight, graph[tail][arc_index].weight);
+    }
+  }
+  return max_weight;
+}
+
+void dijkstra_on_buckets(const Graph& graph, int source,
+                         vector<int>& distance) {
+  GraphBucketHeap<int> active_vertices(graph.size(), max_arc_weight(graph));
+  dijkstra_on_graph_heap(graph, source, distance, active_vertices);
+}
+
+void distance_table(const Graph& graph,
+                    const vector<int>& sources,
+                    const vector<int>& targets,
+                    vector<int>& table) {
+  table.assign(sources.size() * targets.size(), INFINITY);
+
+  // targets may repeat, each search waits for distinct ones
+  vector<bool> is_target(graph.size());
+  int distinct_targets_count = 0;
+  for (int i = 0; i < targets.size(); ++i) {
+    if (!is_target[targets[i]]) {
+      is_target[targets[i]] = true;
+      ++distinct_targets_count;
+    }
+  }
+
+  // workspace shared by all searches, only touched vertices are reset
+  vector<int> distance(graph.size(), INFINITY);
+  vector<bool> settled(graph.size());
+  vector<int> touched_vertices;
+  GraphKaryHeap<int, 4> active_vertices(graph.size());
+
+  for (int source_index = 0; source_index < sources.size(); ++source_index) {
+    int source = sources[source_index];
+    distance[source] = 0;
+    touched_vertices.push_back(source);
+    active_vertices.push(source, 0);
+
+    int unsettled_targets_count = distinct_targets_count;
+    while (!active_vertices.empty() && unsettled_targets_count > 0) {
+      int tail = active_vertices.top();
+      active_vertices.pop();
+      settled[tail] = true;
+      if (is_target[tail]) {
+        --unsettled_targets_count;
+      }
+
+      for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+        const Arc& arc = graph[tail][arc_index];
+        int candidate_distance = distance[tail] + arc.weight;
+        if (!settled[arc.head] && distance[arc.head] > candidate_distance) {
+          if (distance[arc.head] == INFINITY) {
+            touched_vertices.push_back(arc.head);
+            active_vertices.push(arc.head, candidate_distance);
+          } else {
+            active_vertices.decrease_key(arc.head, candidate_distance);
+          }
+          distance[arc.head] = candidate_distance;
+        }
+      }
+    }
+
+    // not settled targets are unreachable
+    int* row = &table[source_index * targets.size()];
+    for (int target_index = 0; target_index < targets.size(); ++target_index) {
+      if (settled[targets[target_index]]) {
+        row[target_index] = distance[targets[target_index]];
       }
     }
+
+    for (int i = 0; i < touched_vertices.size(); ++i) {
+      distance[touched_vertices[i]] = INFINITY;
+      settled[touched_vertices[i]] = false;
+    }
+    touched_vertices.clear();
+    active_vertices.clear();
   }
 }
 
 int bidirected_dijkstra(const Graph& graph, int source, int destination) {
+  int settled_vertices_count;
+  return bidirected_dijkstra(graph, source, destination,
+                             settled_vertices_count);
+}
+
+int bidirected_dijkstra(const Graph& graph,
+                        int source,
+                        int destination,
+                        int& settled_vertices_count) {
+  settled_vertices_count = 0;
   std::vector< Graph > graphs(2);
   graphs[0] = graph;
   graphs[1] = invert(graph);
@@ -227,6 +421,7 @@ int bidirected_dijkstra(const Graph& graph, int source, int destination) {
     // find min
     int closest_active_vertex = active_vertices[dijkstra_index].top();
     active_vertices[dijkstra_index].pop();
+    ++settled_vertices_count;
     assert(color[dijkstra_index][closest_active_vertex] == GRAY);
 
     if ((dijkstra_index == 0 && closest_active_vertex == destination) ||
@@ -285,7 +480,7 @@ int bidirected_dijkstra(const Graph& graph, int source, int destination) {
 
 int dijkstra_on_array(const Graph& graph, int source, int destination) {
   vector<int> distance;
-  dijkstra_on_array(graph, source, distance);
+  dijkstra_on_array_until(graph, source, destination, distance);
   return distance[destination];
 }
 
@@ -293,12 +488,41 @@ int dijkstra_on_priority_queue(const Graph& graph,
                                int source,
                                int destination) {
   vector<int> distance;
-  dijkstra_on_priority_queue(graph, source, distance);
+  dijkstra_on_priority_queue_until(graph, source, destination, distance);
   return distance[destination];
 }
 
 int dijkstra_on_set(const Graph& graph, int source, int destination) {
+  ShortestPathWorkspace workspace(graph.size());
+  return dijkstra_on_set(graph, source, destination, workspace);
+}
+
+int dijkstra_on_set(const Graph& graph, int source, int destination,
+                    ShortestPathWorkspace& workspace) {
+  dijkstra_on_set_until(graph, source, destination, workspace);
+  return workspace.distance(destination);
+}
+
+int dijkstra_on_kary_heap(const Graph& graph, int source, int destination,
+                          ShortestPathWorkspace& workspace) {
+  dijkstra_on_kary_heap_until(graph, source, destination, workspace);
+  return workspace.distance(destination);
+}
+
+int dijkstra_on_radix_heap(const Graph& graph, int source, int destination) {
+  vector<int> distance;
+  vector<int> color;
+  GraphRadixHeap<int> active_vertices(graph.size());
+  dijkstra_on_graph_heap(graph, source, distance, color, active_vertices,
+                         destination);
+  return distance[destination];
+}
+
+int dijkstra_on_buckets(const Graph& graph, int source, int destination) {
   vector<int> distance;
-  dijkstra_on_set(graph, source, distance);
+  vector<int> color;
+  GraphBucketHeap<int> active_vertices(graph.size(), max_arc_weight(graph));
+  dijkstra_on_graph_heap(graph, source, distance, color, active_vertices,
+                         destination);
   return distance[destination];
 }
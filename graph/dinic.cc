@@ -0,0 +1,231 @@
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cassert>
+
+#include "graph/common.h"
+#include "graph/csr.h"
+#include "graph/maxflow.h"
+#include "graph/residual_network.h"
+
+using std::vector;
+using std::min;
+
+// Dinic's algorithm: each phase builds levels of vertices by breadth
+// first search from source and saturates layered network by depth
+// first searches. Current arc of vertex only moves forward in phase,
+// so dead arcs are never scanned twice. All buffers live through phases.
+class Dinic {
+ public:
+  Dinic(ResidualNetwork& network, int source, int destination);
+  void run();
+ private:
+  bool build_levels();
+  void augment_blocking_flow();
+
+  int tail(int arc_index) const {
+    return network_.head(network_.reverse_arc(arc_index));
+  }
+
+  ResidualNetwork& network_;
+  int source_;
+  int destination_;
+
+  vector<int> level_;
+  vector<int> current_arc_;
+  vector<int> queue_;
+  // arcs of current path from source
+  vector<int> path_;
+};
+
+Dinic::Dinic(ResidualNetwork& network, int source, int destination)
+    : network_(network),
+      source_(source),
+      destination_(destination),
+      level_(network.size()),
+      current_arc_(network.size()) {
+  queue_.reserve(network.size());
+  path_.reserve(network.size());
+}
+
+bool Dinic::build_levels() {
+  std::fill(level_.begin(), level_.end(), -1);
+  level_[source_] = 0;
+  queue_.clear();
+  queue_.push_back(source_);
+
+  for (int i = 0; i < queue_.size() && level_[destination_] == -1; ++i) {
+    int tail = queue_[i];
+    for (int arc_index = network_.arcs_begin(tail);
+         arc_index < network_.arcs_end(tail);
+         ++arc_index) {
+      int head = network_.head(arc_index);
+      if (level_[head] == -1 && network_.residual_capacity(arc_index) > 0) {
+        level_[head] = level_[tail] + 1;
+        queue_.push_back(head);
+      }
+    }
+  }
+
+  return level_[destination_] != -1;
+}
+
+void Dinic::augment_blocking_flow() {
+  for (int vertex = 0; vertex < network_.size(); ++vertex) {
+    current_arc_[vertex] = network_.arcs_begin(vertex);
+  }
+  path_.clear();
+
+  int vertex = source_;
+  while (true) {
+    if (vertex == destination_) {
+      int value = std::numeric_limits<int>::max();
+      for (int i = 0; i < path_.size(); ++i) {
+        value = min(value, network_.residual_capacity(path_[i]));
+      }
+
+      // retreat to tail of the first saturated arc
+      int saturated_index = -1;
+      for (int i = 0; i < path_.size(); ++i) {
+        network_.push(path_[i], value);
+        if (saturated_index == -1 &&
+            network_.residual_capacity(path_[i]) == 0) {
+          saturated_index = i;
+        }
+      }
+      vertex = tail(path_[saturated_index]);
+      path_.resize(saturated_index);
+      continue;
+    }
+
+    int& arc_index = current_arc_[vertex];
+    int arcs_end = network_.arcs_end(vertex);
+    while (arc_index < arcs_end &&
+           (network_.residual_capacity(arc_index) == 0 ||
+            level_[network_.head(arc_index)] != level_[vertex] + 1)) {
+      ++arc_index;
+    }
+
+    if (arc_index < arcs_end) {
+      path_.push_back(arc_index);
+      vertex = network_.head(arc_index);
+    } else {
+      // dead end, nothing goes through vertex in this phase
+      if (vertex == source_) {
+        break;
+      }
+      level_[vertex] = -1;
+      vertex = tail(path_.back());
+      path_.pop_back();
+      ++current_arc_[vertex];
+    }
+  }
+}
+
+void Dinic::run() {
+  while (build_levels()) {
+    augment_blocking_flow();
+  }
+}
+
+int dinic(const Graph& graph,
+          int source,
+          int destination,
+          Graph& output_flow) {
+  assert(source != destination);
+
+  ResidualNetwork network(graph);
+  Dinic dinic(network, source, destination);
+  dinic.run();
+  return network.extract_flow(source, output_flow);
+}
+
+// blocking flows of Dinic on residual network packed from arrays,
+// no adjacency lists are built
+int blocking_flows(const CsrGraph& graph,
+                   int source,
+                   int destination,
+                   Graph& output_flow) {
+  assert(source != destination);
+
+  ResidualNetwork network(graph);
+  Dinic dinic(network, source, destination);
+  dinic.run();
+  return network.extract_flow(source, output_flow);
+}
+
+void decompose_flow(const Graph& flow,
+                    int source,
+                    int destination,
+                    vector<FlowPath>& paths) {
+  paths.clear();
+  Graph remaining_flow = flow;
+  vector<int> current_arc(flow.size());
+  // position of vertex in current path, -1 if it is not there
+  vector<int> path_position(flow.size(), -1);
+  vector<int> path_vertices;
+  vector<int> path_arcs;
+
+  path_vertices.push_back(source);
+  path_position[source] = 0;
+  while (!path_vertices.empty()) {
+    int vertex = path_vertices.back();
+    if (vertex == destination) {
+      int value = std::numeric_limits<int>::max();
+      for (int i = 0; i < path_arcs.size(); ++i) {
+        value = min(value,
+                    remaining_flow[path_vertices[i]][path_arcs[i]].weight);
+      }
+      for (int i = 0; i < path_arcs.size(); ++i) {
+        remaining_flow[path_vertices[i]][path_arcs[i]].weight -= value;
+      }
+      paths.push_back(FlowPath(path_vertices, value));
+
+      for (int i = 1; i < path_vertices.size(); ++i) {
+        path_position[path_vertices[i]] = -1;
+      }
+      path_vertices.resize(1);
+      path_arcs.clear();
+      continue;
+    }
+
+    int& arc_index = current_arc[vertex];
+    while (arc_index < remaining_flow[vertex].size() &&
+           remaining_flow[vertex][arc_index].weight == 0) {
+      ++arc_index;
+    }
+    if (arc_index == remaining_flow[vertex].size()) {
+      // no flow leaves vertex, in conserved flow it is only source
+      path_position[vertex] = -1;
+      path_vertices.pop_back();
+      if (!path_arcs.empty()) {
+        path_arcs.pop_back();
+        ++current_arc[path_vertices.back()];
+      }
+      continue;
+    }
+
+    int head = remaining_flow[vertex][arc_index].head;
+    path_arcs.push_back(arc_index);
+    if (path_position[head] == -1) {
+      path_position[head] = path_vertices.size();
+      path_vertices.push_back(head);
+    } else {
+      // cycle of flow, cancel it and go on from its start
+      int cycle_begin = path_position[head];
+      int value = std::numeric_limits<int>::max();
+      for (int i = cycle_begin; i < path_arcs.size(); ++i) {
+        value = min(value,
+                    remaining_flow[path_vertices[i]][path_arcs[i]].weight);
+      }
+      for (int i = cycle_begin; i < path_arcs.size(); ++i) {
+        remaining_flow[path_vertices[i]][path_arcs[i]].weight -= value;
+      }
+      for (int i = cycle_begin + 1; i < path_vertices.size(); ++i) {
+        path_position[path_vertices[i]] = -1;
+      }
+      path_vertices.resize(cycle_begin + 1);
+      path_arcs.resize(cycle_begin);
+    }
+  }
+}
@@ -0,0 +1,167 @@
+#include "graph/dynamic_shortest_path_tree.h"
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include "graph/common.h"
+#include "graph/heap.h"
+
+using std::vector;
+
+DynamicShortestPathTree::DynamicShortestPathTree(const Graph& graph,
+                                                 int source)
+    : graph_(graph),
+      inverted_graph_(invert(graph)),
+      source_(source),
+      distance_(graph.size(), INFINITY),
+      parent_(graph.size(), -1),
+      color_(graph.size(), WHITE),
+      active_vertices_(graph.size()),
+      affected_vertices_count_(0) {
+  reach(source, 0, -1);
+  propagate();
+  affected_vertices_count_ = 0;
+}
+
+int DynamicShortestPathTree::inverted_arc_index(int tail,
+                                                int head,
+                                                int weight) const {
+  const vector<Arc>& arcs = inverted_graph_[head];
+  for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+    if (arcs[arc_index].head == tail && arcs[arc_index].weight == weight) {
+      return arc_index;
+    }
+  }
+  assert(false);
+  return -1;
+}
+
+void DynamicShortestPathTree::set_weight(int tail,
+                                         int arc_index,
+                                         int weight) {
+  assert(weight >= 0);
+  affected_vertices_count_ = 0;
+  Arc& arc = graph_[tail][arc_index];
+  int old_weight = arc.weight;
+  inverted_graph_[arc.head][inverted_arc_index(tail, arc.head,
+                                               old_weight)].weight = weight;
+  arc.weight = weight;
+
+  if (weight < old_weight) {
+    shorten_arc(tail, arc.head, weight);
+  } else if (weight > old_weight) {
+    lengthen_arc(tail, arc.head, old_weight);
+  }
+}
+
+int DynamicShortestPathTree::add_arc(int tail, int head, int weight) {
+  assert(weight >= 0);
+  affected_vertices_count_ = 0;
+  graph_[tail].push_back(Arc(head, weight));
+  inverted_graph_[head].push_back(Arc(tail, weight));
+  shorten_arc(tail, head, weight);
+  return graph_[tail].size() - 1;
+}
+
+void DynamicShortestPathTree::remove_arc(int tail, int arc_index) {
+  affected_vertices_count_ = 0;
+  Arc arc = graph_[tail][arc_index];
+  vector<Arc>& inverted_arcs = inverted_graph_[arc.head];
+  inverted_arcs[inverted_arc_index(tail, arc.head, arc.weight)] =
+      inverted_arcs.back();
+  inverted_arcs.pop_back();
+  graph_[tail][arc_index] = graph_[tail].back();
+  graph_[tail].pop_back();
+
+  lengthen_arc(tail, arc.head, arc.weight);
+}
+
+void DynamicShortestPathTree::shorten_arc(int tail, int head, int weight) {
+  if (distance_[tail] != INFINITY &&
+      distance_[tail] + weight < distance_[head]) {
+    reach(head, distance_[tail] + weight, tail);
+    propagate();
+  }
+}
+
+// arc matters only if it was the tree arc to head
+void DynamicShortestPathTree::lengthen_arc(int tail,
+                                           int head,
+                                           int weight) {
+  if (parent_[head] != tail ||
+      distance_[tail] + weight != distance_[head]) {
+    return;
+  }
+  invalidate_subtree(head);
+
+  // the best arcs from outside, their tails keep their distances
+  for (int i = 0; i < subtree_vertices_.size(); ++i) {
+    int vertex = subtree_vertices_[i];
+    const vector<Arc>& arcs = inverted_graph_[vertex];
+    for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+      const Arc& arc = arcs[arc_index];
+      if (distance_[arc.head] != INFINITY &&
+          distance_[arc.head] + arc.weight < distance_[vertex]) {
+        reach(vertex, distance_[arc.head] + arc.weight, arc.head);
+      }
+    }
+  }
+  propagate();
+  affected_vertices_count_ = subtree_vertices_.size();
+}
+
+// children of vertex are heads of its arcs, which have it as parent;
+// vertices of subtree lose their distances and parents
+void DynamicShortestPathTree::invalidate_subtree(int root) {
+  subtree_vertices_.clear();
+  subtree_vertices_.push_back(root);
+  distance_[root] = INFINITY;
+  parent_[root] = -1;
+  for (int i = 0; i < subtree_vertices_.size(); ++i) {
+    int tail = subtree_vertices_[i];
+    for (int arc_index = 0; arc_index < graph_[tail].size(); ++arc_index) {
+      int head = graph_[tail][arc_index].head;
+      // parallel arcs meet child again with parent already dropped
+      if (parent_[head] == tail) {
+        subtree_vertices_.push_back(head);
+        distance_[head] = INFINITY;
+        parent_[head] = -1;
+      }
+    }
+  }
+}
+
+void DynamicShortestPathTree::reach(int vertex, int distance, int parent) {
+  assert(color_[vertex] != BLACK);
+  distance_[vertex] = distance;
+  parent_[vertex] = parent;
+  if (color_[vertex] == WHITE) {
+    color_[vertex] = GRAY;
+    touched_vertices_.push_back(vertex);
+    active_vertices_.push(vertex, distance);
+  } else {
+    active_vertices_.decrease_key(vertex, distance);
+  }
+}
+
+void DynamicShortestPathTree::propagate() {
+  while (!active_vertices_.empty()) {
+    int tail = active_vertices_.top();
+    active_vertices_.pop();
+    color_[tail] = BLACK;
+    ++affected_vertices_count_;
+
+    for (int arc_index = 0; arc_index < graph_[tail].size(); ++arc_index) {
+      const Arc& arc = graph_[tail][arc_index];
+      if (distance_[tail] + arc.weight < distance_[arc.head]) {
+        reach(arc.head, distance_[tail] + arc.weight, tail);
+      }
+    }
+  }
+
+  for (int i = 0; i < touched_vertices_.size(); ++i) {
+    color_[touched_vertices_[i]] = WHITE;
+  }
+  touched_vertices_.clear();
+}
@@ -1,7 +1,12 @@
+#include <pthread.h>
+#include <immintrin.h>
+
+#include <cstddef>
 #include <vector>
 #include <algorithm>
 
 #include "graph/common.h"
+#include "graph/threads.h"
 
 using std::vector;
 
@@ -34,3 +39,174 @@ void floyd(const Graph& graph,
     }
   }
 }
+
+namespace {
+
+// Square tiles of BLOCK_SIZE x BLOCK_SIZE elements in row-major
+// distance matrix of padded_size x padded_size elements.
+// Each iteration of blocked algorithm handles BLOCK_SIZE values of k:
+// first the diagonal tile, then tiles in its row and column,
+// then all remaining tiles, the last two phases are parallel.
+const int BLOCK_SIZE = 64;
+
+// min-plus product: c[i][j] = min(c[i][j], a[i][k] + b[k][j])
+// for tile c, k iterates in outer loop, so c may coincide with a or b
+void min_plus_tiles(int* c, const int* a, const int* b, int row_size) {
+  for (int k = 0; k < BLOCK_SIZE; ++k) {
+    const int* b_row = b + k * row_size;
+    for (int i = 0; i < BLOCK_SIZE; ++i) {
+      int a_value = a[i * row_size + k];
+      if (a_value == INFINITY) {
+        continue;
+      }
+      int* c_row = c + i * row_size;
+      for (int j = 0; j < BLOCK_SIZE; ++j) {
+        if (b_row[j] != INFINITY) {
+          c_row[j] = std::min(c_row[j], a_value + b_row[j]);
+        }
+      }
+    }
+  }
+}
+
+__attribute__((target("avx2")))
+void min_plus_tiles_avx2(int* c, const int* a, const int* b, int row_size) {
+  const __m256i infinity = _mm256_set1_epi32(INFINITY);
+  for (int k = 0; k < BLOCK_SIZE; ++k) {
+    const int* b_row = b + k * row_size;
+    for (int i = 0; i < BLOCK_SIZE; ++i) {
+      int a_value = a[i * row_size + k];
+      if (a_value == INFINITY) {
+        continue;
+      }
+      __m256i a_values = _mm256_set1_epi32(a_value);
+      int* c_row = c + i * row_size;
+      for (int j = 0; j < BLOCK_SIZE; j += 8) {
+        __m256i b_values = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(b_row + j));
+        __m256i c_values = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(c_row + j));
+        __m256i sums = _mm256_add_epi32(a_values, b_values);
+        sums = _mm256_blendv_epi8(sums, infinity,
+                                  _mm256_cmpeq_epi32(b_values, infinity));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(c_row + j),
+                            _mm256_min_epi32(c_values, sums));
+      }
+    }
+  }
+}
+
+class BlockedFloyd {
+ public:
+  BlockedFloyd(int padded_size, int threads_count, vector<int>& distance);
+  ~BlockedFloyd();
+
+  void run(int thread_index);
+ private:
+  int* tile(int block_row, int block_column) {
+    return &distance_[(static_cast<size_t>(block_row) * padded_size_ +
+                       block_column) * BLOCK_SIZE];
+  }
+
+  void update_tile(int block_row, int block_column, int block_k) {
+    void (*min_plus)(int*, const int*, const int*, int) =
+        use_avx2_ ? min_plus_tiles_avx2 : min_plus_tiles;
+    min_plus(tile(block_row, block_column),
+             tile(block_row, block_k),
+             tile(block_k, block_column),
+             padded_size_);
+  }
+
+  int padded_size_;
+  int blocks_count_;
+  int threads_count_;
+  bool use_avx2_;
+  vector<int>& distance_;
+  pthread_barrier_t barrier_;
+};
+
+BlockedFloyd::BlockedFloyd(int padded_size,
+                           int threads_count,
+                           vector<int>& distance)
+    : padded_size_(padded_size),
+      blocks_count_(padded_size / BLOCK_SIZE),
+      threads_count_(threads_count),
+      use_avx2_(__builtin_cpu_supports("avx2")),
+      distance_(distance) {
+  pthread_barrier_init(&barrier_, NULL, threads_count);
+}
+
+BlockedFloyd::~BlockedFloyd() {
+  pthread_barrier_destroy(&barrier_);
+}
+
+void BlockedFloyd::run(int thread_index) {
+  for (int block_k = 0; block_k < blocks_count_; ++block_k) {
+    if (thread_index == 0) {
+      update_tile(block_k, block_k, block_k);
+    }
+    pthread_barrier_wait(&barrier_);
+
+    // tiles in row and column of diagonal tile
+    for (int task = thread_index;
+         task < 2 * blocks_count_;
+         task += threads_count_) {
+      int block = task / 2;
+      if (block != block_k) {
+        if (task % 2 == 0) {
+          update_tile(block_k, block, block_k);
+        } else {
+          update_tile(block, block_k, block_k);
+        }
+      }
+    }
+    pthread_barrier_wait(&barrier_);
+
+    // remaining tiles
+    for (int task = thread_index;
+         task < blocks_count_ * blocks_count_;
+         task += threads_count_) {
+      int block_row = task / blocks_count_;
+      int block_column = task % blocks_count_;
+      if (block_row != block_k && block_column != block_k) {
+        update_tile(block_row, block_column, block_k);
+      }
+    }
+    pthread_barrier_wait(&barrier_);
+  }
+}
+
+}  // namespace
+
+void blocked_floyd(const Graph& graph,
+                   vector< vector<int> >& shortest_paths,
+                   int threads_count) {
+  int size = graph.size();
+  int padded_size = (size + BLOCK_SIZE - 1) / BLOCK_SIZE * BLOCK_SIZE;
+  // matrix may have more than INT_MAX elements
+  vector<int> distance(static_cast<size_t>(padded_size) * padded_size,
+                       INFINITY);
+
+  for (int tail = 0; tail < size; ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      int& element =
+          distance[static_cast<size_t>(tail) * padded_size + arc.head];
+      element = std::min(element, arc.weight);
+    }
+  }
+
+  for (int vertex = 0; vertex < padded_size; ++vertex) {
+    distance[static_cast<size_t>(vertex) * padded_size + vertex] = 0;
+  }
+
+  BlockedFloyd blocked_floyd(padded_size, threads_count, distance);
+  run_in_threads(blocked_floyd, threads_count);
+
+  shortest_paths.assign(size, vector<int>());
+  for (int vertex = 0; vertex < size; ++vertex) {
+    vector<int>::const_iterator row =
+        distance.begin() + static_cast<size_t>(vertex) * padded_size;
+    shortest_paths[vertex].assign(row, row + size);
+  }
+}
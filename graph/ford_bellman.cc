@@ -3,6 +3,9 @@
 #include <iostream>
 
 #include "graph/common.h"
+#include "graph/csr.h"
+#include "graph/ssspp.h"
+#include "graph/shortest_path_workspace.h"
 
 using std::vector;
 using std::queue;
@@ -33,6 +36,41 @@ void ford_bellman(const Graph& graph,
 void ford_bellman_on_queue(const Graph& graph,
                            int source,
                            std::vector<int>& distance) {
+  ShortestPathWorkspace workspace(graph.size());
+  ford_bellman_on_queue(graph, source, workspace);
+  workspace.get_distances(distance);
+}
+
+void ford_bellman_on_queue(const Graph& graph,
+                           int source,
+                           ShortestPathWorkspace& workspace) {
+  workspace.reset(graph.size());
+  workspace.set_distance(source, 0);
+  workspace.set_color(source, GRAY);
+  workspace.enqueue(source);
+
+  while (!workspace.queue_empty()) {
+    int tail = workspace.dequeue();
+    workspace.set_color(tail, BLACK);
+
+    int tail_distance = workspace.distance(tail);
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      if (workspace.distance(arc.head) > tail_distance + arc.weight) {
+        workspace.set_distance(arc.head, tail_distance + arc.weight);
+        workspace.set_parent(arc.head, tail);
+        if (workspace.color(arc.head) != GRAY) {
+          workspace.set_color(arc.head, GRAY);
+          workspace.enqueue(arc.head);
+        }
+      }
+    }
+  }
+}
+
+void ford_bellman_on_queue(const CsrGraph& graph,
+                           int source,
+                           std::vector<int>& distance) {
   distance.assign(graph.size(), INFINITY);
   distance[source] = 0;
 
@@ -48,13 +86,16 @@ void ford_bellman_on_queue(const Graph& graph,
 
     color[tail] = BLACK;
 
-    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
-      const Arc& arc = graph[tail][arc_index];
-      if (distance[arc.head] > distance[tail] + arc.weight) {
-        distance[arc.head] = distance[tail] + arc.weight;
-        if (color[arc.head] != GRAY) {
-          color[arc.head] = GRAY;
-          active_vertices.push(arc.head);
+    int arcs_end = graph.arcs_end(tail);
+    for (int arc_index = graph.arcs_begin(tail);
+         arc_index < arcs_end;
+         ++arc_index) {
+      int head = graph.head(arc_index);
+      if (distance[head] > distance[tail] + graph.weight(arc_index)) {
+        distance[head] = distance[tail] + graph.weight(arc_index);
+        if (color[head] != GRAY) {
+          color[head] = GRAY;
+          active_vertices.push(head);
         }
       }
     }
@@ -68,6 +109,17 @@ int ford_bellman(const Graph& graph, int source, int destination) {
 }
 
 int ford_bellman_on_queue(const Graph& graph, int source, int destination) {
+  ShortestPathWorkspace workspace(graph.size());
+  return ford_bellman_on_queue(graph, source, destination, workspace);
+}
+
+int ford_bellman_on_queue(const Graph& graph, int source, int destination,
+                          ShortestPathWorkspace& workspace) {
+  ford_bellman_on_queue(graph, source, workspace);
+  return workspace.distance(destination);
+}
+
+int ford_bellman_on_queue(const CsrGraph& graph, int source, int destination) {
   vector<int> distance;
   ford_bellman_on_queue(graph, source, distance);
   return distance[destination];
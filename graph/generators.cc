@@ -0,0 +1,337 @@
+#include "graph/generators.h"
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include "graph/common.h"
+#include "graph/reorder.h"
+#include "graph/threads.h"
+
+using std::vector;
+
+namespace {
+
+// arcs of chunk i are sampled by stream i of random generator
+const int ARCS_CHUNK_SIZE = 1 << 16;
+
+// Sampler provides
+//   void sample(RandomGenerator& random, int& tail, Arc& arc) const;
+template <class Sampler>
+class ParallelArcs {
+ public:
+  ParallelArcs(const Sampler& sampler,
+               int arcs_count,
+               unsigned long long seed)
+      : sampler_(sampler),
+        seed_(seed),
+        tails_(arcs_count),
+        arcs_(arcs_count),
+        next_chunk_(0)
+    { }
+
+  void run(int thread_index);
+  Graph to_graph(int vertices_count) const;
+ private:
+  const Sampler& sampler_;
+  unsigned long long seed_;
+  vector<int> tails_;
+  vector<Arc> arcs_;
+  int next_chunk_;
+};
+
+template <class Sampler>
+void ParallelArcs<Sampler>::run(int thread_index) {
+  while (true) {
+    int chunk = __sync_fetch_and_add(&next_chunk_, 1);
+    long long begin = static_cast<long long>(chunk) * ARCS_CHUNK_SIZE;
+    if (begin >= arcs_.size()) {
+      break;
+    }
+    int end = std::min<long long>(begin + ARCS_CHUNK_SIZE, arcs_.size());
+    RandomGenerator random(seed_, chunk);
+    for (int i = begin; i < end; ++i) {
+      sampler_.sample(random, tails_[i], arcs_[i]);
+    }
+  }
+}
+
+// arcs of each tail keep order of sampling
+template <class Sampler>
+Graph ParallelArcs<Sampler>::to_graph(int vertices_count) const {
+  vector<int> degree(vertices_count, 0);
+  for (int i = 0; i < tails_.size(); ++i) {
+    ++degree[tails_[i]];
+  }
+  Graph graph(vertices_count);
+  for (int vertex = 0; vertex < vertices_count; ++vertex) {
+    graph[vertex].reserve(degree[vertex]);
+  }
+  for (int i = 0; i < tails_.size(); ++i) {
+    graph[tails_[i]].push_back(arcs_[i]);
+  }
+  return graph;
+}
+
+template <class Sampler>
+Graph generate_arcs(const Sampler& sampler,
+                    int vertices_count,
+                    int arcs_count,
+                    unsigned long long seed,
+                    int threads_count) {
+  ParallelArcs<Sampler> parallel_arcs(sampler, arcs_count, seed);
+  run_in_threads(parallel_arcs, threads_count);
+  return parallel_arcs.to_graph(vertices_count);
+}
+
+// hubs of skewed generators have small ids, shuffle spreads them;
+// it takes stream -1, chunks of arcs take non-negative ones
+Graph shuffle_vertices(const Graph& graph, unsigned long long seed) {
+  RandomGenerator random(seed, -1);
+  vector<int> old_id(graph.size());
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    old_id[vertex] = vertex;
+  }
+  for (int i = graph.size() - 1; i > 0; --i) {
+    std::swap(old_id[i], old_id[random.uniform(i + 1)]);
+  }
+  vector<int> new_id;
+  return reorder(graph, old_id, new_id);
+}
+
+class UniformSampler {
+ public:
+  explicit UniformSampler(int vertices_count)
+      : vertices_count_(vertices_count)
+    { }
+
+  void sample(RandomGenerator& random, int& tail, Arc& arc) const {
+    tail = random.uniform(vertices_count_);
+    arc.head = random.uniform(vertices_count_ - 1);
+    if (arc.head >= tail) {
+      ++arc.head;
+    }
+    arc.weight = random.uniform(MAX_WEIGHT);
+  }
+ private:
+  int vertices_count_;
+};
+
+// probabilities of quadrants of adjacency matrix
+const double RMAT_A = 0.57;
+const double RMAT_B = 0.19;
+const double RMAT_C = 0.19;
+
+class RmatSampler {
+ public:
+  explicit RmatSampler(int scale)
+      : scale_(scale)
+    { }
+
+  void sample(RandomGenerator& random, int& tail, Arc& arc) const {
+    do {
+      tail = 0;
+      arc.head = 0;
+      for (int bit = scale_ - 1; bit >= 0; --bit) {
+        double quadrant = random.uniform_real();
+        if (quadrant >= RMAT_A + RMAT_B) {
+          tail |= 1 << bit;
+        }
+        if ((quadrant >= RMAT_A && quadrant < RMAT_A + RMAT_B) ||
+            quadrant >= RMAT_A + RMAT_B + RMAT_C) {
+          arc.head |= 1 << bit;
+        }
+      }
+    } while (tail == arc.head);
+    arc.weight = random.uniform(MAX_WEIGHT);
+  }
+ private:
+  int scale_;
+};
+
+class PowerLawSampler {
+ public:
+  PowerLawSampler(int vertices_count, double exponent);
+
+  void sample(RandomGenerator& random, int& tail, Arc& arc) const {
+    tail = sample_vertex(random);
+    do {
+      arc.head = sample_vertex(random);
+    } while (arc.head == tail);
+    arc.weight = random.uniform(MAX_WEIGHT);
+  }
+ private:
+  int sample_vertex(RandomGenerator& random) const {
+    double point = random.uniform_real() * cumulative_weight_.back();
+    return std::upper_bound(cumulative_weight_.begin(),
+                            cumulative_weight_.end(),
+                            point) - cumulative_weight_.begin();
+  }
+
+  // sums of weights of vertices up to each one inclusive
+  vector<double> cumulative_weight_;
+};
+
+PowerLawSampler::PowerLawSampler(int vertices_count, double exponent)
+    : cumulative_weight_(vertices_count) {
+  assert(exponent > 2);
+  double sum = 0;
+  for (int vertex = 0; vertex < vertices_count; ++vertex) {
+    sum += std::pow(vertex + 1.0, -1.0 / (exponent - 1));
+    cumulative_weight_[vertex] = sum;
+  }
+}
+
+class LayeredDagSampler {
+ public:
+  LayeredDagSampler(int layers_count, int layer_width)
+      : layers_count_(layers_count),
+        layer_width_(layer_width)
+    { }
+
+  void sample(RandomGenerator& random, int& tail, Arc& arc) const {
+    int layer = random.uniform(layers_count_ - 1);
+    tail = layer * layer_width_ + random.uniform(layer_width_);
+    arc.head = (layer + 1) * layer_width_ + random.uniform(layer_width_);
+    arc.weight = random.uniform(MAX_WEIGHT);
+  }
+ private:
+  int layers_count_;
+  int layer_width_;
+};
+
+// threads take rows by chunks of this size
+const int ROAD_ROWS_CHUNK_SIZE = 16;
+
+// Each vertex builds its own arcs, weight of street is drawn from
+// stream of its lower end, so both directions get the same weight
+// without sharing anything between threads.
+class ParallelRoads {
+ public:
+  ParallelRoads(int rows,
+                int columns,
+                unsigned long long seed,
+                Graph& graph)
+      : rows_(rows),
+        columns_(columns),
+        seed_(seed),
+        graph_(graph),
+        next_row_(0) {
+    graph_.assign(rows * columns, vector<Arc>());
+  }
+
+  void run(int thread_index);
+ private:
+  // weights of streets from vertex to the right and down
+  void street_weights(int row, int column, int& right, int& down) const;
+  void add_street(int tail, int head, int weight) {
+    graph_[tail].push_back(Arc(head, weight));
+  }
+
+  int rows_;
+  int columns_;
+  unsigned long long seed_;
+  Graph& graph_;
+  int next_row_;
+};
+
+void ParallelRoads::street_weights(int row,
+                                   int column,
+                                   int& right,
+                                   int& down) const {
+  RandomGenerator random(seed_, row * columns_ + column);
+  right = 100 + random.uniform(900);
+  down = 100 + random.uniform(900);
+  if (row % ROAD_HIGHWAY_STEP == 0) {
+    right /= ROAD_HIGHWAY_SPEEDUP;
+  }
+  if (column % ROAD_HIGHWAY_STEP == 0) {
+    down /= ROAD_HIGHWAY_SPEEDUP;
+  }
+}
+
+void ParallelRoads::run(int thread_index) {
+  while (true) {
+    int begin = __sync_fetch_and_add(&next_row_, ROAD_ROWS_CHUNK_SIZE);
+    if (begin >= rows_) {
+      break;
+    }
+    int end = std::min(begin + ROAD_ROWS_CHUNK_SIZE, rows_);
+    for (int row = begin; row < end; ++row) {
+      for (int column = 0; column < columns_; ++column) {
+        int vertex = row * columns_ + column;
+        int right, down, unused;
+        street_weights(row, column, right, down);
+        if (column + 1 < columns_) {
+          add_street(vertex, vertex + 1, right);
+        }
+        if (row + 1 < rows_) {
+          add_street(vertex, vertex + columns_, down);
+        }
+        if (column > 0) {
+          street_weights(row, column - 1, right, unused);
+          add_street(vertex, vertex - 1, right);
+        }
+        if (row > 0) {
+          street_weights(row - 1, column, unused, down);
+          add_street(vertex, vertex - columns_, down);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+Graph generate_uniform_graph(int vertices_count,
+                             int arcs_count,
+                             unsigned long long seed,
+                             int threads_count) {
+  assert(vertices_count >= 2);
+  return generate_arcs(UniformSampler(vertices_count),
+                       vertices_count, arcs_count, seed, threads_count);
+}
+
+Graph generate_rmat_graph(int scale,
+                          int arcs_count,
+                          unsigned long long seed,
+                          int threads_count) {
+  assert(scale >= 1 && scale < 31);
+  return shuffle_vertices(generate_arcs(RmatSampler(scale), 1 << scale,
+                                        arcs_count, seed, threads_count),
+                          seed);
+}
+
+Graph generate_power_law_graph(int vertices_count,
+                               int arcs_count,
+                               double exponent,
+                               unsigned long long seed,
+                               int threads_count) {
+  assert(vertices_count >= 2);
+  return shuffle_vertices(
+      generate_arcs(PowerLawSampler(vertices_count, exponent),
+                    vertices_count, arcs_count, seed, threads_count),
+      seed);
+}
+
+Graph generate_road_graph(int rows,
+                          int columns,
+                          unsigned long long seed,
+                          int threads_count) {
+  Graph graph;
+  ParallelRoads parallel_roads(rows, columns, seed, graph);
+  run_in_threads(parallel_roads, threads_count);
+  return graph;
+}
+
+Graph generate_layered_dag(int layers_count,
+                           int layer_width,
+                           int arcs_count,
+                           unsigned long long seed,
+                           int threads_count) {
+  assert(layers_count >= 2 && layer_width >= 1);
+  return generate_arcs(LayeredDagSampler(layers_count, layer_width),
+                       layers_count * layer_width, arcs_count,
+                       seed, threads_count);
+}
@@ -0,0 +1,159 @@
+#include "graph/graph_file.h"
+
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <climits>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+
+#include "graph/common.h"
+#include "graph/csr.h"
+
+using std::string;
+using std::vector;
+
+namespace {
+
+const uint32_t GRAPH_FILE_MAGIC = 0x47524254;  // "TBRG"
+const uint32_t GRAPH_FILE_VERSION = 1;
+
+struct GraphFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t vertices_count;
+  uint32_t arcs_count;
+};
+
+void write_ints(std::ostream& out, const vector<int>& values) {
+  if (!values.empty()) {
+    out.write(reinterpret_cast<const char*>(&values[0]),
+              values.size() * sizeof(values[0]));
+  }
+}
+
+}  // namespace
+
+void save_graph(const Graph& graph, const string& filename) {
+  std::ofstream out(filename.c_str(), std::ios::binary);
+  if (!out.is_open()) {
+    throw std::runtime_error(filename + " can't be opened for write");
+  }
+
+  vector<int> offsets(graph.size() + 1, 0);
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    offsets[tail + 1] = offsets[tail] + graph[tail].size();
+  }
+  vector<int> heads;
+  vector<int> weights;
+  heads.reserve(offsets[graph.size()]);
+  weights.reserve(offsets[graph.size()]);
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      heads.push_back(graph[tail][arc_index].head);
+      weights.push_back(graph[tail][arc_index].weight);
+    }
+  }
+
+  GraphFileHeader header;
+  header.magic = GRAPH_FILE_MAGIC;
+  header.version = GRAPH_FILE_VERSION;
+  header.vertices_count = graph.size();
+  header.arcs_count = offsets[graph.size()];
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  write_ints(out, offsets);
+  write_ints(out, heads);
+  write_ints(out, weights);
+
+  if (!out) {
+    throw std::runtime_error(filename + " can't write file");
+  }
+}
+
+MappedGraph::MappedGraph(const string& filename)
+    : data_(MAP_FAILED),
+      length_(0) {
+  map_file(filename, false);
+}
+
+MappedGraph::MappedGraph(const string& filename, bool check_heads)
+    : data_(MAP_FAILED),
+      length_(0) {
+  map_file(filename, check_heads);
+}
+
+void MappedGraph::map_file(const string& filename, bool check_heads) {
+  int descriptor = open(filename.c_str(), O_RDONLY);
+  if (descriptor == -1) {
+    throw std::runtime_error(filename + " can't be opened for read");
+  }
+  struct stat file_status;
+  if (fstat(descriptor, &file_status) == -1) {
+    close(descriptor);
+    throw std::runtime_error(filename + " can't read file");
+  }
+  length_ = file_status.st_size;
+  if (length_ < sizeof(GraphFileHeader)) {
+    close(descriptor);
+    throw std::runtime_error(filename + " is not graph file");
+  }
+  data_ = mmap(NULL, length_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  // mapping stays valid after descriptor is closed
+  close(descriptor);
+  if (data_ == MAP_FAILED) {
+    throw std::runtime_error(filename + " can't be mapped");
+  }
+
+  const GraphFileHeader* header = static_cast<const GraphFileHeader*>(data_);
+  // header is 16 bytes, so arrays stay aligned
+  const int* offsets = reinterpret_cast<const int*>(header + 1);
+  string error;
+  if (header->magic != GRAPH_FILE_MAGIC) {
+    error = filename + " is not graph file";
+  } else if (header->version != GRAPH_FILE_VERSION) {
+    error = filename + " has unsupported version";
+  } else if (header->vertices_count > INT_MAX ||
+             header->arcs_count > INT_MAX) {
+    error = filename + " is too large";
+  } else if (length_ != sizeof(*header) + sizeof(*offsets) *
+             (header->vertices_count + 1 + 2ULL * header->arcs_count)) {
+    error = filename + " has wrong size";
+  }
+
+  // counts and arrays are read only if header is consistent
+  int vertices_count = error.empty() ? header->vertices_count : 0;
+  int arcs_count = error.empty() ? header->arcs_count : 0;
+  if (error.empty() &&
+      (offsets[0] != 0 || offsets[vertices_count] != arcs_count)) {
+    error = filename + " has wrong offsets";
+  }
+  for (int vertex = 0; error.empty() && vertex < vertices_count; ++vertex) {
+    if (offsets[vertex] > offsets[vertex + 1]) {
+      error = filename + " has wrong offsets";
+    }
+  }
+  const int* heads = offsets + vertices_count + 1;
+  const int* weights = heads + arcs_count;
+  for (int arc_index = 0;
+       check_heads && error.empty() && arc_index < arcs_count;
+       ++arc_index) {
+    if (heads[arc_index] < 0 || heads[arc_index] >= vertices_count) {
+      error = filename + " has wrong heads";
+    }
+  }
+  if (!error.empty()) {
+    munmap(data_, length_);
+    throw std::runtime_error(error);
+  }
+
+  graph_ = CsrGraph(vertices_count, offsets, heads, weights);
+}
+
+MappedGraph::~MappedGraph() {
+  munmap(data_, length_);
+}
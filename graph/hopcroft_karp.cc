@@ -0,0 +1,196 @@
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "graph/common.h"
+#include "graph/maxflow.h"
+
+using std::vector;
+using std::pair;
+
+// Hopcroft-Karp: each phase finds layers of alternating paths by
+// breadth first search from free left vertices, then augments along
+// maximal set of vertex disjoint shortest augmenting paths found by
+// depth first searches. There are O(sqrt(V)) phases.
+class HopcroftKarp {
+ public:
+  HopcroftKarp(int left_part_size,
+               int right_part_size,
+               const vector< pair<int, int> >& arcs);
+  void greedy_initialization();
+  int run();
+  const vector<int>& left_part_matches() const { return left_part_matches_; }
+ private:
+  bool build_layers();
+  bool augment(int root);
+
+  int left_part_size_;
+
+  // neighbors of left vertex v are heads_[offsets_[v] .. offsets_[v + 1])
+  vector<int> offsets_;
+  vector<int> heads_;
+
+  vector<int> left_part_matches_;
+  vector<int> right_part_matches_;
+  int matching_size_;
+
+  // layer of left vertex, INFINITY for dead ones
+  vector<int> layer_;
+  // layer which free right vertices are reached at
+  int free_layer_;
+  vector<int> current_arc_;
+  vector<int> queue_;
+  vector<int> stack_;
+};
+
+HopcroftKarp::HopcroftKarp(int left_part_size,
+                           int right_part_size,
+                           const vector< pair<int, int> >& arcs)
+    : left_part_size_(left_part_size),
+      offsets_(left_part_size + 1, 0),
+      heads_(arcs.size()),
+      left_part_matches_(left_part_size, -1),
+      right_part_matches_(right_part_size, -1),
+      matching_size_(0),
+      layer_(left_part_size),
+      free_layer_(INFINITY),
+      current_arc_(left_part_size) {
+  for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+    ++offsets_[arcs[arc_index].first + 1];
+  }
+  for (int vertex = 0; vertex < left_part_size; ++vertex) {
+    offsets_[vertex + 1] += offsets_[vertex];
+  }
+  vector<int> next_arc(offsets_.begin(), offsets_.end() - 1);
+  for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+    heads_[next_arc[arcs[arc_index].first]++] = arcs[arc_index].second;
+  }
+  queue_.reserve(left_part_size);
+  stack_.reserve(left_part_size);
+}
+
+// matches each left vertex to its first free neighbor
+void HopcroftKarp::greedy_initialization() {
+  for (int left = 0; left < left_part_size_; ++left) {
+    for (int arc_index = offsets_[left];
+         arc_index < offsets_[left + 1] && left_part_matches_[left] == -1;
+         ++arc_index) {
+      int right = heads_[arc_index];
+      if (right_part_matches_[right] == -1) {
+        left_part_matches_[left] = right;
+        right_part_matches_[right] = left;
+        ++matching_size_;
+      }
+    }
+  }
+}
+
+bool HopcroftKarp::build_layers() {
+  queue_.clear();
+  for (int left = 0; left < left_part_size_; ++left) {
+    if (left_part_matches_[left] == -1) {
+      layer_[left] = 0;
+      queue_.push_back(left);
+    } else {
+      layer_[left] = INFINITY;
+    }
+  }
+
+  free_layer_ = INFINITY;
+  for (int i = 0; i < queue_.size(); ++i) {
+    int left = queue_[i];
+    if (layer_[left] >= free_layer_) {
+      break;
+    }
+    for (int arc_index = offsets_[left];
+         arc_index < offsets_[left + 1];
+         ++arc_index) {
+      int next_left = right_part_matches_[heads_[arc_index]];
+      if (next_left == -1) {
+        free_layer_ = std::min(free_layer_, layer_[left] + 1);
+      } else if (layer_[next_left] == INFINITY) {
+        layer_[next_left] = layer_[left] + 1;
+        queue_.push_back(next_left);
+      }
+    }
+  }
+
+  return free_layer_ != INFINITY;
+}
+
+// iterative depth first search by layers from free left vertex
+bool HopcroftKarp::augment(int root) {
+  stack_.clear();
+  stack_.push_back(root);
+  while (!stack_.empty()) {
+    int left = stack_.back();
+    int& arc_index = current_arc_[left];
+    int next_left = -1;
+    for (; arc_index < offsets_[left + 1]; ++arc_index) {
+      next_left = right_part_matches_[heads_[arc_index]];
+      if (next_left == -1 ? layer_[left] + 1 == free_layer_
+                          : layer_[next_left] == layer_[left] + 1) {
+        break;
+      }
+    }
+
+    if (arc_index == offsets_[left + 1]) {
+      // dead end
+      layer_[left] = INFINITY;
+      stack_.pop_back();
+      if (!stack_.empty()) {
+        ++current_arc_[stack_.back()];
+      }
+    } else if (next_left == -1) {
+      // flip matching along path
+      for (int i = stack_.size() - 1; i >= 0; --i) {
+        int path_left = stack_[i];
+        int right = heads_[current_arc_[path_left]];
+        left_part_matches_[path_left] = right;
+        right_part_matches_[right] = path_left;
+        layer_[path_left] = INFINITY;
+      }
+      ++matching_size_;
+      return true;
+    } else {
+      stack_.push_back(next_left);
+    }
+  }
+  return false;
+}
+
+int HopcroftKarp::run() {
+  while (build_layers()) {
+    for (int left = 0; left < left_part_size_; ++left) {
+      current_arc_[left] = offsets_[left];
+    }
+    for (int left = 0; left < left_part_size_; ++left) {
+      if (left_part_matches_[left] == -1 && layer_[left] == 0) {
+        augment(left);
+      }
+    }
+  }
+  return matching_size_;
+}
+
+int hopcroft_karp(int left_part_size,
+                  int right_part_size,
+                  const vector< pair<int, int> >& arcs,
+                  vector<int>& left_part_matches,
+                  bool use_greedy_initialization) {
+  HopcroftKarp hopcroft_karp(left_part_size, right_part_size, arcs);
+  if (use_greedy_initialization) {
+    hopcroft_karp.greedy_initialization();
+  }
+  int matching_size = hopcroft_karp.run();
+  left_part_matches = hopcroft_karp.left_part_matches();
+  return matching_size;
+}
+
+int hopcroft_karp(int left_part_size,
+                  int right_part_size,
+                  const vector< pair<int, int> >& arcs) {
+  vector<int> left_part_matches;
+  return hopcroft_karp(left_part_size, right_part_size, arcs,
+                       left_part_matches, true);
+}
@@ -2,26 +2,46 @@
 #include <algorithm>
 
 #include "graph/common.h"
+#include "graph/csr.h"
 #include "graph/ssspp.h"
+#include "graph/heap.h"
+#include "graph/threads.h"
 
 using std::vector;
 
-void johnson(const Graph& graph,
-             vector< vector<int> >& shortest_paths) {
+// distances from extra source with zero arcs to every vertex,
+// returns false if graph has negative cycle
+bool compute_potentials(const Graph& graph, vector<int>& potential) {
   Graph sourced_graph = add_source_vertex(graph);
+  if (!tarjan_ssspp(sourced_graph, graph.size(), potential)) {
+    return false;
+  }
+  potential.pop_back();
+  return true;
+}
 
-  vector<int> potential;
-  ford_bellman(sourced_graph, graph.size(), potential);
-
-  // update distance
+// makes all arc weights non-negative keeping shortest paths
+Graph reweight(const Graph& graph, const vector<int>& potential) {
   Graph updated_distance_graph(graph.size());
   for (int tail = 0; tail < graph.size(); ++tail) {
+    updated_distance_graph[tail].reserve(graph[tail].size());
     for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
       const Arc& arc = graph[tail][arc_index];
       updated_distance_graph[tail].push_back(
         Arc(arc.head, arc.weight + potential[tail] - potential[arc.head]));
     }
   }
+  return updated_distance_graph;
+}
+
+bool johnson(const Graph& graph,
+             vector< vector<int> >& shortest_paths) {
+  vector<int> potential;
+  if (!compute_potentials(graph, potential)) {
+    shortest_paths.clear();
+    return false;
+  }
+  Graph updated_distance_graph = reweight(graph, potential);
 
   shortest_paths.assign(graph.size(), vector<int>());
   for (int source = 0; source < graph.size(); ++source) {
@@ -33,4 +53,106 @@ void johnson(const Graph& graph,
           (potential[source] - potential[destination]);
     }
   }
+  return true;
+}
+
+// Sources are taken by threads one by one, each thread
+// keeps its own heap and color buffer for all its sources,
+// distances are written right into output rows.
+class ParallelJohnson {
+ public:
+  ParallelJohnson(const Graph& graph,
+                  const vector<int>& potential,
+                  vector< vector<int> >& shortest_paths)
+      : graph_(graph),
+        potential_(potential),
+        shortest_paths_(shortest_paths),
+        next_source_(0)
+    { }
+
+  void run(int thread_index);
+ private:
+  const Graph& graph_;
+  const vector<int>& potential_;
+  vector< vector<int> >& shortest_paths_;
+  int next_source_;
+};
+
+void ParallelJohnson::run(int thread_index) {
+  GraphKaryHeap<int, 4> active_vertices(graph_.size());
+  vector<int> color(graph_.size());
+
+  while (true) {
+    int source = __sync_fetch_and_add(&next_source_, 1);
+    if (source >= graph_.size()) {
+      break;
+    }
+
+    vector<int>& distance = shortest_paths_[source];
+    dijkstra_on_graph_heap(graph_, source, distance, color, active_vertices);
+    for (int destination = 0; destination < graph_.size(); ++destination) {
+      if (distance[destination] != INFINITY) {
+        distance[destination] -=
+            (potential_[source] - potential_[destination]);
+      }
+    }
+  }
+}
+
+bool parallel_johnson(const Graph& graph,
+                      vector< vector<int> >& shortest_paths,
+                      int threads_count) {
+  vector<int> potential;
+  if (!compute_potentials(graph, potential)) {
+    shortest_paths.clear();
+    return false;
+  }
+  Graph updated_distance_graph = reweight(graph, potential);
+
+  shortest_paths.assign(graph.size(), vector<int>(graph.size()));
+  ParallelJohnson parallel_johnson(updated_distance_graph,
+                                   potential,
+                                   shortest_paths);
+  run_in_threads(parallel_johnson, threads_count);
+  return true;
+}
+
+bool johnson(const CsrGraph& graph,
+             vector< vector<int> >& shortest_paths) {
+  // potentials are computed once on adjacency lists,
+  // only tarjan_ssspp detects negative cycles
+  vector<int> potential;
+  if (!compute_potentials(graph.to_graph(), potential)) {
+    shortest_paths.clear();
+    return false;
+  }
+
+  vector<int> offsets(graph.size() + 1);
+  vector<int> heads(graph.arcs_count());
+  vector<int> weights(graph.arcs_count());
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    offsets[tail + 1] = graph.arcs_end(tail);
+    for (int arc_index = graph.arcs_begin(tail);
+         arc_index < graph.arcs_end(tail);
+         ++arc_index) {
+      heads[arc_index] = graph.head(arc_index);
+      weights[arc_index] = graph.weight(arc_index) +
+          potential[tail] - potential[heads[arc_index]];
+    }
+  }
+  CsrGraph updated_distance_graph(offsets, heads, weights);
+
+  shortest_paths.assign(graph.size(), vector<int>());
+  for (int source = 0; source < graph.size(); ++source) {
+    dijkstra_on_kary_heap<2>(updated_distance_graph,
+                             source,
+                             shortest_paths[source]);
+    for (int destination = 0; destination < graph.size(); ++destination) {
+      if (shortest_paths[source][destination] != INFINITY) {
+        shortest_paths[source][destination] -=
+            (potential[source] - potential[destination]);
+      }
+    }
+  }
+  return true;
 }
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <iostream>
 #include <utility>
+#include <stdexcept>
 
 using std::vector;
 using std::queue;
@@ -19,26 +20,6 @@ using std::make_pair;
 using std::cerr;
 using std::endl;
 
-struct LinkedArc {
-  int head;
-  int weight;
-  int inv_arc_index;
-
-  LinkedArc()
-      : head(-1),
-        weight(-1),
-        inv_arc_index(-1)
-  { }
-
-  LinkedArc(int h, int w, int ind)
-      : head(h),
-        weight(w),
-        inv_arc_index(ind)
-  { }
-};
-
-typedef vector< vector<LinkedArc> > LinkedGraph;
-
 void initialize_capacity_and_flow(const Graph& graph,
                                   Graph& capacity,
                                   LinkedGraph& flow) {
@@ -324,6 +305,19 @@ int augment_blocking_flow(const Graph& capacity,
   return sended_flow;
 }
   
+void augment_by_blocking_flows(const Graph& capacity,
+                               LinkedGraph& flow,
+                               int source,
+                               int destination) {
+  vector< list<int> > arc_indexes;
+  while (build_shortest_paths_graph(capacity, flow,
+                                    source, destination,
+                                    arc_indexes)) {
+    while (augment_blocking_flow(capacity, flow, arc_indexes,
+                                 source, destination, INFINITY) != 0) { }
+  }
+}
+
 int blocking_flows(const Graph& graph,
                    int source,
                    int destination,
@@ -334,16 +328,141 @@ int blocking_flows(const Graph& graph,
   Graph capacity;
   LinkedGraph flow;
   initialize_capacity_and_flow(graph, capacity, flow);
+  augment_by_blocking_flows(capacity, flow, source, destination);
+  return extract_real_flow(flow, source, output_flow);
+}
 
-  vector< list<int> > arc_indexes;
-  while (build_shortest_paths_graph(capacity, flow,
-                                    source, destination,
-                                    arc_indexes)) {
-    while (augment_blocking_flow(capacity, flow, arc_indexes,
-                                 source, destination, INFINITY) != 0) { }
+MaxFlowSolver::MaxFlowSolver(const Graph& graph, int source, int destination)
+    : source_(source),
+      destination_(destination),
+      pred_(graph.size()),
+      visited_(graph.size()) {
+  assert(source != destination);
+  initialize_capacity_and_flow(graph, capacity_, flow_);
+  active_vertices_.reserve(graph.size());
+
+  // replay initialization to find positions of arcs in adjacency lists
+  vector<int> lists_sizes(graph.size(), 0);
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      arcs_.push_back(make_pair(tail, lists_sizes[tail]++));
+      ++lists_sizes[graph[tail][arc_index].head];
+    }
   }
+}
 
-  return extract_real_flow(flow, source, output_flow);
+int MaxFlowSolver::capacity(int arc_id) const {
+  return capacity_[arcs_[arc_id].first][arcs_[arc_id].second].weight;
+}
+
+int MaxFlowSolver::flow(int arc_id) const {
+  return flow_[arcs_[arc_id].first][arcs_[arc_id].second].weight;
+}
+
+void MaxFlowSolver::set_capacity(int arc_id, int capacity) {
+  int tail = arcs_[arc_id].first;
+  int arc_index = arcs_[arc_id].second;
+  capacity_[tail][arc_index].weight = capacity;
+
+  int excess = flow_[tail][arc_index].weight - capacity;
+  if (excess > 0) {
+    add_flow(flow_, tail, arc_index, -excess);
+    reroute(tail, capacity_[tail][arc_index].head, excess);
+  }
+}
+
+int MaxFlowSolver::add_arc(int tail, int head, int capacity) {
+  int forward_arc_index = flow_[tail].size();
+  int inv_arc_index = flow_[head].size();
+  capacity_[tail].push_back(Arc(head, capacity));
+  capacity_[head].push_back(Arc(tail, 0));
+  flow_[tail].push_back(LinkedArc(head, 0, inv_arc_index));
+  flow_[head].push_back(LinkedArc(tail, 0, forward_arc_index));
+
+  arcs_.push_back(make_pair(tail, forward_arc_index));
+  return arcs_.size() - 1;
+}
+
+// Flow on arc from -> to was cut by value, so from has excess and
+// to has deficit. Excess goes by residual paths to to, the rest is
+// returned to source and taken back from destination.
+void MaxFlowSolver::reroute(int from, int to, int value) {
+  value -= send(from, to, value);
+  if (value == 0) {
+    return;
+  }
+  if (from != source_ && from != destination_) {
+    // flow came to from along arcs carrying it, so it can go back
+    if (send(from, source_, value) != value) {
+      throw std::logic_error("MaxFlowSolver: excess can't be returned");
+    }
+  }
+  if (to != source_ && to != destination_) {
+    if (send(destination_, to, value) != value) {
+      throw std::logic_error("MaxFlowSolver: deficit can't be covered");
+    }
+  }
+}
+
+// pushes up to value units by shortest residual paths,
+// returns pushed amount
+int MaxFlowSolver::send(int from, int to, int value) {
+  int sended_flow = 0;
+  while (sended_flow < value) {
+    std::fill(visited_.begin(), visited_.end(), false);
+    visited_[from] = true;
+    active_vertices_.clear();
+    active_vertices_.push_back(from);
+    for (int i = 0; i < active_vertices_.size() && !visited_[to]; ++i) {
+      int tail = active_vertices_[i];
+      for (int arc_index = 0; arc_index < capacity_[tail].size(); ++arc_index) {
+        int head = capacity_[tail][arc_index].head;
+        if (!visited_[head] &&
+            capacity_[tail][arc_index].weight
+            - flow_[tail][arc_index].weight > 0) {
+          visited_[head] = true;
+          active_vertices_.push_back(head);
+          pred_[head] = make_pair(tail, arc_index);
+        }
+      }
+    }
+    if (!visited_[to]) {
+      break;
+    }
+
+    int path_value = value - sended_flow;
+    for (int current = to; current != from; current = pred_[current].first) {
+      int previous = pred_[current].first;
+      int arc_index = pred_[current].second;
+      path_value = min(path_value,
+                       capacity_[previous][arc_index].weight -
+                       flow_[previous][arc_index].weight);
+    }
+    for (int current = to; current != from; current = pred_[current].first) {
+      add_flow(flow_, pred_[current].first, pred_[current].second, path_value);
+    }
+    sended_flow += path_value;
+  }
+
+  return sended_flow;
+}
+
+int MaxFlowSolver::solve() {
+  augment_by_blocking_flows(capacity_, flow_, source_, destination_);
+  return flow_value();
+}
+
+// reverse arcs keep negated flow, so sum is net flow out of source
+int MaxFlowSolver::flow_value() const {
+  int value = 0;
+  for (int arc_index = 0; arc_index < flow_[source_].size(); ++arc_index) {
+    value += flow_[source_][arc_index].weight;
+  }
+  return value;
+}
+
+void MaxFlowSolver::get_flow(Graph& output_flow) const {
+  extract_real_flow(flow_, source_, output_flow);
 }
 
 int get_max_bipartite_matching(const Graph& graph) {
@@ -0,0 +1,332 @@
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cassert>
+#include <deque>
+
+#include "graph/common.h"
+#include "graph/heap.h"
+#include "graph/maxflow.h"
+#include "graph/residual_network.h"
+#include "graph/ssspp.h"
+
+using std::vector;
+using std::min;
+using std::max;
+
+// Successive shortest paths: potentials keep reduced costs of residual
+// arcs non-negative, so every shortest path is found by Dijkstra.
+// Dijkstra stops at destination, only settled vertices get their
+// potentials updated by distance minus distance of destination.
+class SuccessiveShortestPaths {
+ public:
+  SuccessiveShortestPaths(ResidualNetwork& network,
+                          int source,
+                          int destination);
+  int run();
+ private:
+  void initialize_potentials();
+  bool find_shortest_path();
+  int augment();
+
+  long long reduced_cost(int tail, int arc_index) const {
+    return network_.cost(arc_index) + potential_[tail] -
+        potential_[network_.head(arc_index)];
+  }
+
+  ResidualNetwork& network_;
+  int source_;
+  int destination_;
+
+  vector<long long> potential_;
+  vector<long long> distance_;
+  vector<int> color_;
+  vector<int> parent_arc_;
+  vector<int> settled_vertices_;
+  GraphKaryHeap<long long, 4> active_vertices_;
+};
+
+SuccessiveShortestPaths::SuccessiveShortestPaths(ResidualNetwork& network,
+                                                 int source,
+                                                 int destination)
+    : network_(network),
+      source_(source),
+      destination_(destination),
+      potential_(network.size(), 0),
+      distance_(network.size()),
+      color_(network.size()),
+      parent_arc_(network.size(), -1),
+      active_vertices_(network.size()) {
+  settled_vertices_.reserve(network.size());
+}
+
+// with negative costs potentials are distances by Bellman-Ford,
+// vertices unreachable from source never get reachable
+void SuccessiveShortestPaths::initialize_potentials() {
+  bool has_negative_costs = false;
+  Graph graph(network_.size());
+  for (int tail = 0; tail < network_.size(); ++tail) {
+    for (int arc_index = network_.arcs_begin(tail);
+         arc_index < network_.arcs_end(tail);
+         ++arc_index) {
+      if (network_.residual_capacity(arc_index) > 0) {
+        graph[tail].push_back(Arc(network_.head(arc_index),
+                                  network_.cost(arc_index)));
+        has_negative_costs |= network_.cost(arc_index) < 0;
+      }
+    }
+  }
+  if (!has_negative_costs) {
+    return;
+  }
+
+  vector<int> distances;
+  ford_bellman_on_queue(graph, source_, distances);
+  for (int vertex = 0; vertex < network_.size(); ++vertex) {
+    if (distances[vertex] != INFINITY) {
+      potential_[vertex] = distances[vertex];
+    }
+  }
+}
+
+bool SuccessiveShortestPaths::find_shortest_path() {
+  std::fill(color_.begin(), color_.end(), WHITE);
+  settled_vertices_.clear();
+
+  distance_[source_] = 0;
+  color_[source_] = GRAY;
+  active_vertices_.push(source_, 0);
+  while (!active_vertices_.empty()) {
+    int tail = active_vertices_.top();
+    active_vertices_.pop();
+    color_[tail] = BLACK;
+    settled_vertices_.push_back(tail);
+    if (tail == destination_) {
+      break;
+    }
+
+    for (int arc_index = network_.arcs_begin(tail);
+         arc_index < network_.arcs_end(tail);
+         ++arc_index) {
+      int head = network_.head(arc_index);
+      if (network_.residual_capacity(arc_index) == 0 ||
+          color_[head] == BLACK) {
+        continue;
+      }
+      long long distance = distance_[tail] + reduced_cost(tail, arc_index);
+      if (color_[head] == WHITE) {
+        color_[head] = GRAY;
+        distance_[head] = distance;
+        parent_arc_[head] = arc_index;
+        active_vertices_.push(head, distance);
+      } else if (distance < distance_[head]) {
+        distance_[head] = distance;
+        parent_arc_[head] = arc_index;
+        active_vertices_.decrease_key(head, distance);
+      }
+    }
+  }
+  active_vertices_.clear();
+
+  if (color_[destination_] != BLACK) {
+    return false;
+  }
+  for (int i = 0; i < settled_vertices_.size(); ++i) {
+    int vertex = settled_vertices_[i];
+    potential_[vertex] += distance_[vertex] - distance_[destination_];
+  }
+  return true;
+}
+
+int SuccessiveShortestPaths::augment() {
+  int value = std::numeric_limits<int>::max();
+  for (int vertex = destination_; vertex != source_; ) {
+    int arc_index = parent_arc_[vertex];
+    value = min(value, network_.residual_capacity(arc_index));
+    vertex = network_.head(network_.reverse_arc(arc_index));
+  }
+  for (int vertex = destination_; vertex != source_; ) {
+    int arc_index = parent_arc_[vertex];
+    network_.push(arc_index, value);
+    vertex = network_.head(network_.reverse_arc(arc_index));
+  }
+  return value;
+}
+
+int SuccessiveShortestPaths::run() {
+  initialize_potentials();
+  int flow_value = 0;
+  while (find_shortest_path()) {
+    flow_value += augment();
+  }
+  return flow_value;
+}
+
+int successive_shortest_paths(const CostGraph& graph,
+                              int source,
+                              int destination,
+                              long long& cost,
+                              Graph& flow) {
+  assert(source != destination);
+
+  ResidualNetwork network(graph);
+  SuccessiveShortestPaths successive_shortest_paths(network,
+                                                    source,
+                                                    destination);
+  successive_shortest_paths.run();
+  cost = network.flow_cost();
+  return network.extract_flow(source, flow);
+}
+
+// epsilon is divided by this factor between refinements
+const int COST_SCALING_FACTOR = 16;
+
+// Cost scaling: flow is eps-optimal if reduced costs of all residual
+// arcs are at least -eps. Costs are multiplied by n + 1, then 1-optimal
+// flow is optimal. Each refinement saturates arcs of negative reduced
+// cost and then pushes excesses along arcs of negative reduced cost,
+// relabel lowers potential just enough to make some arc admissible.
+class CostScaling {
+ public:
+  CostScaling(ResidualNetwork& network,
+              int source,
+              int destination,
+              int flow_value);
+  void run();
+ private:
+  void refine(long long epsilon);
+  void discharge(int vertex, long long epsilon);
+  void relabel(int vertex, long long epsilon);
+  void push(int tail, int arc_index, int value);
+
+  long long reduced_cost(int tail, int arc_index) const {
+    return network_.cost(arc_index) * scale_ + potential_[tail] -
+        potential_[network_.head(arc_index)];
+  }
+
+  ResidualNetwork& network_;
+  long long scale_;
+
+  vector<long long> potential_;
+  vector<long long> excess_;
+  vector<int> current_arc_;
+  std::deque<int> active_vertices_;
+};
+
+CostScaling::CostScaling(ResidualNetwork& network,
+                         int source,
+                         int destination,
+                         int flow_value)
+    : network_(network),
+      scale_(network.size() + 1),
+      potential_(network.size(), 0),
+      excess_(network.size(), 0),
+      current_arc_(network.size()) {
+  excess_[source] += flow_value;
+  excess_[destination] -= flow_value;
+}
+
+void CostScaling::push(int tail, int arc_index, int value) {
+  int head = network_.head(arc_index);
+  network_.push(arc_index, value);
+  excess_[tail] -= value;
+  if (excess_[head] <= 0 && excess_[head] + value > 0) {
+    active_vertices_.push_back(head);
+  }
+  excess_[head] += value;
+}
+
+void CostScaling::relabel(int vertex, long long epsilon) {
+  long long potential = std::numeric_limits<long long>::min();
+  for (int arc_index = network_.arcs_begin(vertex);
+       arc_index < network_.arcs_end(vertex);
+       ++arc_index) {
+    if (network_.residual_capacity(arc_index) > 0) {
+      potential = max(potential,
+                      potential_[network_.head(arc_index)] -
+                      network_.cost(arc_index) * scale_);
+    }
+  }
+  // flow is feasible, so excess always has a way out
+  assert(potential != std::numeric_limits<long long>::min());
+  potential_[vertex] = potential - epsilon;
+}
+
+void CostScaling::discharge(int vertex, long long epsilon) {
+  while (excess_[vertex] > 0) {
+    int& arc_index = current_arc_[vertex];
+    if (arc_index == network_.arcs_end(vertex)) {
+      relabel(vertex, epsilon);
+      arc_index = network_.arcs_begin(vertex);
+      continue;
+    }
+
+    int residual_capacity = network_.residual_capacity(arc_index);
+    if (residual_capacity > 0 && reduced_cost(vertex, arc_index) < 0) {
+      push(vertex, arc_index,
+           min(static_cast<long long>(residual_capacity), excess_[vertex]));
+    } else {
+      ++arc_index;
+    }
+  }
+}
+
+void CostScaling::refine(long long epsilon) {
+  active_vertices_.clear();
+  for (int vertex = 0; vertex < network_.size(); ++vertex) {
+    current_arc_[vertex] = network_.arcs_begin(vertex);
+    if (excess_[vertex] > 0) {
+      active_vertices_.push_back(vertex);
+    }
+  }
+  for (int tail = 0; tail < network_.size(); ++tail) {
+    for (int arc_index = network_.arcs_begin(tail);
+         arc_index < network_.arcs_end(tail);
+         ++arc_index) {
+      int residual_capacity = network_.residual_capacity(arc_index);
+      if (residual_capacity > 0 && reduced_cost(tail, arc_index) < 0) {
+        push(tail, arc_index, residual_capacity);
+      }
+    }
+  }
+
+  while (!active_vertices_.empty()) {
+    int vertex = active_vertices_.front();
+    active_vertices_.pop_front();
+    discharge(vertex, epsilon);
+  }
+}
+
+void CostScaling::run() {
+  long long epsilon = 1;
+  for (int arc_index = 0; arc_index < network_.arcs_count(); ++arc_index) {
+    epsilon = max(epsilon, network_.cost(arc_index) * scale_);
+  }
+  do {
+    epsilon = max(1LL, epsilon / COST_SCALING_FACTOR);
+    refine(epsilon);
+  } while (epsilon > 1);
+}
+
+int cost_scaling(const CostGraph& graph,
+                 int source,
+                 int destination,
+                 long long& cost,
+                 Graph& flow) {
+  assert(source != destination);
+
+  Graph capacities(graph.size());
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const CostArc& arc = graph[tail][arc_index];
+      capacities[tail].push_back(Arc(arc.head, arc.capacity));
+    }
+  }
+  int flow_value = dinic(capacities, source, destination, flow);
+
+  ResidualNetwork network(graph);
+  CostScaling cost_scaling(network, source, destination, flow_value);
+  cost_scaling.run();
+  cost = network.flow_cost();
+  return network.extract_flow(source, flow);
+}
@@ -0,0 +1,173 @@
+#include <pthread.h>
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include "graph/common.h"
+#include "graph/ssspp.h"
+#include "graph/threads.h"
+
+using std::vector;
+
+// threads take frontier vertices by chunks of this size
+const int FRONTIER_CHUNK_SIZE = 256;
+
+// Rounds are separated by barriers: all threads relax arcs of
+// frontier vertices, then thread 0 collects vertices updated in the
+// round into next frontier. Label of vertex packs its distance with
+// number of arcs of the path, both are replaced together by CAS only
+// when distance gets strictly shorter. Such path of n arcs has a cycle,
+// which made distance of its vertex shorter, so it's negative.
+// Bitmap keeps each vertex in next frontier only once.
+class ParallelFordBellman {
+ public:
+  ParallelFordBellman(const Graph& graph,
+                      int source,
+                      int threads_count);
+  ~ParallelFordBellman();
+
+  void run(int thread_index);
+  bool get_distances(vector<int>& distance) const;
+ private:
+  static unsigned long long label(int distance, int path_length) {
+    return (static_cast<unsigned long long>(
+        static_cast<unsigned int>(distance)) << 32) |
+        static_cast<unsigned int>(path_length);
+  }
+  static int distance(unsigned long long label) {
+    return static_cast<int>(label >> 32);
+  }
+  static int path_length(unsigned long long label) {
+    return static_cast<int>(label & 0xffffffffULL);
+  }
+
+  void relax(int tail, int thread_index);
+  void mark_updated(int vertex, int thread_index);
+  void prepare_frontier();
+
+  const Graph& graph_;
+  int threads_count_;
+
+  vector<unsigned long long> labels_;
+  vector<int> frontier_;
+  int next_frontier_index_;
+  // bit of vertex is set while vertex waits for next frontier
+  vector<unsigned int> updated_bits_;
+  vector< vector<int> > updated_vertices_;
+  bool negative_cycle_;
+  bool done_;
+
+  pthread_barrier_t barrier_;
+};
+
+ParallelFordBellman::ParallelFordBellman(const Graph& graph,
+                                         int source,
+                                         int threads_count)
+    : graph_(graph),
+      threads_count_(threads_count),
+      labels_(graph.size(), label(INFINITY, 0)),
+      frontier_(1, source),
+      next_frontier_index_(0),
+      updated_bits_((graph.size() + 31) / 32, 0),
+      updated_vertices_(threads_count),
+      negative_cycle_(false),
+      done_(false) {
+  assert(threads_count > 0);
+  labels_[source] = label(0, 0);
+  pthread_barrier_init(&barrier_, NULL, threads_count);
+}
+
+ParallelFordBellman::~ParallelFordBellman() {
+  pthread_barrier_destroy(&barrier_);
+}
+
+void ParallelFordBellman::run(int thread_index) {
+  while (true) {
+    while (true) {
+      int begin = __sync_fetch_and_add(&next_frontier_index_,
+                                       FRONTIER_CHUNK_SIZE);
+      if (begin >= frontier_.size()) {
+        break;
+      }
+      int end = std::min<int>(begin + FRONTIER_CHUNK_SIZE, frontier_.size());
+      for (int i = begin; i < end; ++i) {
+        relax(frontier_[i], thread_index);
+      }
+    }
+    pthread_barrier_wait(&barrier_);
+
+    if (thread_index == 0) {
+      prepare_frontier();
+    }
+    pthread_barrier_wait(&barrier_);
+
+    if (done_) {
+      break;
+    }
+  }
+}
+
+void ParallelFordBellman::relax(int tail, int thread_index) {
+  // label is read at once, so distance and path length match
+  unsigned long long tail_label = labels_[tail];
+  int tail_distance = distance(tail_label);
+  int head_path_length = path_length(tail_label) + 1;
+  for (int arc_index = 0; arc_index < graph_[tail].size(); ++arc_index) {
+    const Arc& arc = graph_[tail][arc_index];
+    int head_distance = tail_distance + arc.weight;
+    unsigned long long head_label = label(head_distance, head_path_length);
+    unsigned long long current = labels_[arc.head];
+    while (head_distance < distance(current)) {
+      if (__sync_bool_compare_and_swap(&labels_[arc.head],
+                                       current, head_label)) {
+        if (head_path_length >= graph_.size()) {
+          negative_cycle_ = true;
+        }
+        mark_updated(arc.head, thread_index);
+        break;
+      }
+      current = labels_[arc.head];
+    }
+  }
+}
+
+void ParallelFordBellman::mark_updated(int vertex, int thread_index) {
+  unsigned int bit = 1u << (vertex % 32);
+  if ((updated_bits_[vertex / 32] & bit) == 0 &&
+      (__sync_fetch_and_or(&updated_bits_[vertex / 32], bit) & bit) == 0) {
+    updated_vertices_[thread_index].push_back(vertex);
+  }
+}
+
+void ParallelFordBellman::prepare_frontier() {
+  frontier_.clear();
+  next_frontier_index_ = 0;
+  for (int thread_index = 0; thread_index < threads_count_; ++thread_index) {
+    vector<int>& updated_vertices = updated_vertices_[thread_index];
+    for (int i = 0; i < updated_vertices.size(); ++i) {
+      int vertex = updated_vertices[i];
+      updated_bits_[vertex / 32] &= ~(1u << (vertex % 32));
+      frontier_.push_back(vertex);
+    }
+    updated_vertices.clear();
+  }
+  done_ = negative_cycle_ || frontier_.empty();
+}
+
+bool ParallelFordBellman::get_distances(vector<int>& distance) const {
+  distance.resize(graph_.size());
+  for (int vertex = 0; vertex < graph_.size(); ++vertex) {
+    distance[vertex] = ParallelFordBellman::distance(labels_[vertex]);
+  }
+  return !negative_cycle_;
+}
+
+bool parallel_ford_bellman(const Graph& graph,
+                           int source,
+                           vector<int>& distance,
+                           int threads_count) {
+  ParallelFordBellman parallel_ford_bellman(graph, source, threads_count);
+  run_in_threads(parallel_ford_bellman, threads_count);
+  return parallel_ford_bellman.get_distances(distance);
+}
@@ -0,0 +1,273 @@
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include "graph/common.h"
+#include "graph/maxflow.h"
+#include "graph/residual_network.h"
+
+using std::vector;
+using std::min;
+using std::max;
+
+// global relabeling runs after relabels have scanned
+// this many arcs per vertex and arc of network
+const int GLOBAL_RELABEL_VERTEX_WORK = 6;
+const int GLOBAL_RELABEL_ARC_WORK = 1;
+
+// Push-relabel with highest label selection. Vertices which can reach
+// destination have heights below n, the others have heights in [n, 2n)
+// and return their excess back to source, so there is no second phase.
+// Active vertices are kept in stacks by height. Vertices of each height
+// below n are also kept in doubly linked lists for the gap heuristic:
+// if no vertex has height h, vertices above h can't reach destination.
+class PushRelabel {
+ public:
+  PushRelabel(ResidualNetwork& network, int source, int destination);
+  void run();
+ private:
+  void global_relabel();
+  void discharge(int vertex);
+  void relabel(int vertex);
+  void gap(int empty_height);
+
+  void add_active(int vertex);
+  void add_to_height_list(int vertex);
+  void remove_from_height_list(int vertex);
+
+  ResidualNetwork& network_;
+  int source_;
+  int destination_;
+  int size_;
+
+  vector<int> height_;
+  vector<long long> excess_;
+  vector<int> current_arc_;
+
+  // stacks of active vertices, vertex may stay in stack of its
+  // old height after gap, it is discharged a bit later then
+  vector<int> first_active_;
+  vector<int> next_active_;
+  int max_active_height_;
+
+  // lists of all vertices by height below n
+  vector<int> first_with_height_;
+  vector<int> next_with_height_;
+  vector<int> previous_with_height_;
+  int max_height_;
+
+  long long work_;
+  long long global_relabel_work_;
+};
+
+PushRelabel::PushRelabel(ResidualNetwork& network,
+                         int source,
+                         int destination)
+    : network_(network),
+      source_(source),
+      destination_(destination),
+      size_(network.size()),
+      height_(size_),
+      excess_(size_),
+      current_arc_(size_),
+      first_active_(2 * size_ + 1),
+      next_active_(size_),
+      max_active_height_(-1),
+      first_with_height_(size_),
+      next_with_height_(size_),
+      previous_with_height_(size_),
+      max_height_(0),
+      work_(0),
+      global_relabel_work_(
+          GLOBAL_RELABEL_VERTEX_WORK * static_cast<long long>(size_) +
+          GLOBAL_RELABEL_ARC_WORK * static_cast<long long>(
+              network.arcs_count())) {
+}
+
+void PushRelabel::add_active(int vertex) {
+  int height = height_[vertex];
+  next_active_[vertex] = first_active_[height];
+  first_active_[height] = vertex;
+  max_active_height_ = max(max_active_height_, height);
+}
+
+void PushRelabel::add_to_height_list(int vertex) {
+  int height = height_[vertex];
+  if (height >= size_) {
+    return;
+  }
+  previous_with_height_[vertex] = -1;
+  next_with_height_[vertex] = first_with_height_[height];
+  if (first_with_height_[height] != -1) {
+    previous_with_height_[first_with_height_[height]] = vertex;
+  }
+  first_with_height_[height] = vertex;
+  max_height_ = max(max_height_, height);
+}
+
+void PushRelabel::remove_from_height_list(int vertex) {
+  int height = height_[vertex];
+  if (height >= size_) {
+    return;
+  }
+  if (previous_with_height_[vertex] != -1) {
+    next_with_height_[previous_with_height_[vertex]] =
+        next_with_height_[vertex];
+  } else {
+    first_with_height_[height] = next_with_height_[vertex];
+  }
+  if (next_with_height_[vertex] != -1) {
+    previous_with_height_[next_with_height_[vertex]] =
+        previous_with_height_[vertex];
+  }
+}
+
+// exact heights by reverse breadth first searches in residual
+// network: from destination, then from source for the rest
+void PushRelabel::global_relabel() {
+  work_ = 0;
+  std::fill(height_.begin(), height_.end(), 2 * size_);
+  std::fill(first_active_.begin(), first_active_.end(), -1);
+  std::fill(first_with_height_.begin(), first_with_height_.end(), -1);
+  max_active_height_ = -1;
+  max_height_ = 0;
+
+  vector<int> queue;
+  queue.reserve(size_);
+  const int roots[] = {destination_, source_};
+  const int root_heights[] = {0, size_};
+  for (int root_index = 0; root_index < 2; ++root_index) {
+    int root = roots[root_index];
+    height_[root] = root_heights[root_index];
+    queue.push_back(root);
+    for (int i = queue.size() - 1; i < queue.size(); ++i) {
+      int head = queue[i];
+      for (int arc_index = network_.arcs_begin(head);
+           arc_index < network_.arcs_end(head);
+           ++arc_index) {
+        int tail = network_.head(arc_index);
+        if (height_[tail] == 2 * size_ &&
+            network_.residual_capacity(network_.reverse_arc(arc_index)) > 0) {
+          height_[tail] = height_[head] + 1;
+          queue.push_back(tail);
+        }
+      }
+    }
+  }
+
+  for (int vertex = 0; vertex < size_; ++vertex) {
+    current_arc_[vertex] = network_.arcs_begin(vertex);
+    if (vertex != source_ && vertex != destination_) {
+      add_to_height_list(vertex);
+      if (excess_[vertex] > 0) {
+        add_active(vertex);
+      }
+    }
+  }
+}
+
+void PushRelabel::discharge(int vertex) {
+  while (excess_[vertex] > 0) {
+    int arcs_end = network_.arcs_end(vertex);
+    int& arc_index = current_arc_[vertex];
+    for (; arc_index < arcs_end; ++arc_index) {
+      int head = network_.head(arc_index);
+      int residual_capacity = network_.residual_capacity(arc_index);
+      if (residual_capacity > 0 && height_[vertex] == height_[head] + 1) {
+        int value = min(excess_[vertex],
+                        static_cast<long long>(residual_capacity));
+        network_.push(arc_index, value);
+        if (excess_[head] == 0 && head != source_ && head != destination_) {
+          add_active(head);
+        }
+        excess_[vertex] -= value;
+        excess_[head] += value;
+        if (excess_[vertex] == 0) {
+          return;
+        }
+      }
+    }
+    relabel(vertex);
+  }
+}
+
+void PushRelabel::relabel(int vertex) {
+  int old_height = height_[vertex];
+  int new_height = 2 * size_;
+  for (int arc_index = network_.arcs_begin(vertex);
+       arc_index < network_.arcs_end(vertex);
+       ++arc_index) {
+    if (network_.residual_capacity(arc_index) > 0) {
+      new_height = min(new_height, height_[network_.head(arc_index)] + 1);
+    }
+  }
+  work_ += network_.arcs_end(vertex) - network_.arcs_begin(vertex) +
+      GLOBAL_RELABEL_VERTEX_WORK;
+  current_arc_[vertex] = network_.arcs_begin(vertex);
+
+  remove_from_height_list(vertex);
+  if (old_height < size_ && first_with_height_[old_height] == -1) {
+    height_[vertex] = max(new_height, size_ + 1);
+    gap(old_height);
+  } else {
+    height_[vertex] = new_height;
+    add_to_height_list(vertex);
+  }
+}
+
+// lifts vertices above empty height to n + 1, it keeps
+// heights valid, as they have no residual arcs below the gap
+void PushRelabel::gap(int empty_height) {
+  for (int height = empty_height + 1; height <= max_height_; ++height) {
+    for (int vertex = first_with_height_[height];
+         vertex != -1;
+         vertex = next_with_height_[vertex]) {
+      height_[vertex] = size_ + 1;
+      current_arc_[vertex] = network_.arcs_begin(vertex);
+    }
+    first_with_height_[height] = -1;
+  }
+  max_height_ = empty_height - 1;
+}
+
+void PushRelabel::run() {
+  for (int arc_index = network_.arcs_begin(source_);
+       arc_index < network_.arcs_end(source_);
+       ++arc_index) {
+    int value = network_.residual_capacity(arc_index);
+    int head = network_.head(arc_index);
+    network_.push(arc_index, value);
+    excess_[head] += value;
+    excess_[source_] -= value;
+  }
+  global_relabel();
+
+  while (true) {
+    if (work_ > global_relabel_work_) {
+      global_relabel();
+    }
+    while (max_active_height_ >= 0 &&
+           first_active_[max_active_height_] == -1) {
+      --max_active_height_;
+    }
+    if (max_active_height_ < 0) {
+      break;
+    }
+
+    int vertex = first_active_[max_active_height_];
+    first_active_[max_active_height_] = next_active_[vertex];
+    discharge(vertex);
+  }
+}
+
+int push_relabel(const Graph& graph,
+                 int source,
+                 int destination,
+                 Graph& output_flow) {
+  assert(source != destination);
+
+  ResidualNetwork network(graph);
+  PushRelabel push_relabel(network, source, destination);
+  push_relabel.run();
+  return network.extract_flow(source, output_flow);
+}
@@ -0,0 +1,203 @@
+#include "graph/reorder.h"
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cassert>
+
+#include "graph/common.h"
+
+using std::vector;
+using std::pair;
+using std::make_pair;
+
+namespace {
+
+// breadth first search over arcs in both directions from each
+// unvisited root in turn; with by_degree roots are taken in order
+// of increasing degree and neighbours are sorted the same way
+void undirected_bfs_order(const Graph& graph,
+                          bool by_degree,
+                          vector<int>& old_id) {
+  Graph inverted_graph = invert(graph);
+  vector<int> degree(graph.size());
+  vector<int> roots(graph.size());
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    degree[vertex] = graph[vertex].size() + inverted_graph[vertex].size();
+    roots[vertex] = vertex;
+  }
+  vector< pair<int, int> > sorted_roots;
+  if (by_degree) {
+    for (int vertex = 0; vertex < graph.size(); ++vertex) {
+      sorted_roots.push_back(make_pair(degree[vertex], vertex));
+    }
+    std::sort(sorted_roots.begin(), sorted_roots.end());
+    for (int i = 0; i < sorted_roots.size(); ++i) {
+      roots[i] = sorted_roots[i].second;
+    }
+  }
+
+  old_id.clear();
+  old_id.reserve(graph.size());
+  vector<bool> visited(graph.size(), false);
+  vector< pair<int, int> > neighbours;
+  for (int i = 0; i < roots.size(); ++i) {
+    if (visited[roots[i]]) {
+      continue;
+    }
+    // old_id works as queue of the search
+    int queue_head = old_id.size();
+    old_id.push_back(roots[i]);
+    visited[roots[i]] = true;
+    while (queue_head < old_id.size()) {
+      int tail = old_id[queue_head++];
+      neighbours.clear();
+      for (int direction = 0; direction < 2; ++direction) {
+        const vector<Arc>& arcs = direction == 0 ? graph[tail]
+                                                 : inverted_graph[tail];
+        for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+          int head = arcs[arc_index].head;
+          if (!visited[head]) {
+            visited[head] = true;
+            neighbours.push_back(make_pair(by_degree ? degree[head] : 0,
+                                           head));
+          }
+        }
+      }
+      if (by_degree) {
+        std::sort(neighbours.begin(), neighbours.end());
+      }
+      for (int j = 0; j < neighbours.size(); ++j) {
+        old_id.push_back(neighbours[j].second);
+      }
+    }
+  }
+}
+
+void degree_order(const Graph& graph, vector<int>& old_id) {
+  vector<int> degree(graph.size());
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    degree[tail] += graph[tail].size();
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      ++degree[graph[tail][arc_index].head];
+    }
+  }
+  // negated degrees sort vertices by decreasing degree, then by id
+  vector< pair<int, int> > sorted_vertices(graph.size());
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    sorted_vertices[vertex] = make_pair(-degree[vertex], vertex);
+  }
+  std::sort(sorted_vertices.begin(), sorted_vertices.end());
+  old_id.resize(graph.size());
+  for (int i = 0; i < graph.size(); ++i) {
+    old_id[i] = sorted_vertices[i].second;
+  }
+}
+
+// points are scaled to grid of this many bits per coordinate
+const int HILBERT_BITS = 16;
+
+// distance of grid point along Hilbert curve filling the grid
+unsigned long long hilbert_key(unsigned int x, unsigned int y) {
+  unsigned long long key = 0;
+  for (unsigned int half = 1u << (HILBERT_BITS - 1); half > 0; half >>= 1) {
+    unsigned int right = (x & half) ? 1 : 0;
+    unsigned int up = (y & half) ? 1 : 0;
+    key += static_cast<unsigned long long>(half) * half * ((3 * right) ^ up);
+    // rotate quadrant, so that curve inside it starts at its corner
+    if (up == 0) {
+      if (right == 1) {
+        x = half - 1 - (x & (half - 1));
+        y = half - 1 - (y & (half - 1));
+      }
+      std::swap(x, y);
+    }
+  }
+  return key;
+}
+
+// coordinate scaled from [min_value, max_value] into grid
+unsigned int scale(int value, int min_value, int max_value) {
+  if (min_value == max_value) {
+    return 0;
+  }
+  return static_cast<unsigned int>(
+      (static_cast<long long>(value) - min_value) *
+      ((1 << HILBERT_BITS) - 1) /
+      (static_cast<long long>(max_value) - min_value));
+}
+
+}  // namespace
+
+void vertex_order(const Graph& graph,
+                  VertexOrder order,
+                  vector<int>& old_id) {
+  if (order == BFS_ORDER) {
+    undirected_bfs_order(graph, false, old_id);
+  } else if (order == REVERSE_CUTHILL_MCKEE_ORDER) {
+    undirected_bfs_order(graph, true, old_id);
+    std::reverse(old_id.begin(), old_id.end());
+  } else {
+    assert(order == DEGREE_ORDER);
+    degree_order(graph, old_id);
+  }
+}
+
+void hilbert_order(const vector< pair<int, int> >& coordinates,
+                   vector<int>& old_id) {
+  old_id.clear();
+  if (coordinates.empty()) {
+    return;
+  }
+  int min_x = coordinates[0].first, max_x = coordinates[0].first;
+  int min_y = coordinates[0].second, max_y = coordinates[0].second;
+  for (int vertex = 0; vertex < coordinates.size(); ++vertex) {
+    min_x = std::min(min_x, coordinates[vertex].first);
+    max_x = std::max(max_x, coordinates[vertex].first);
+    min_y = std::min(min_y, coordinates[vertex].second);
+    max_y = std::max(max_y, coordinates[vertex].second);
+  }
+
+  vector< pair<unsigned long long, int> > keys(coordinates.size());
+  for (int vertex = 0; vertex < coordinates.size(); ++vertex) {
+    keys[vertex] = make_pair(
+        hilbert_key(scale(coordinates[vertex].first, min_x, max_x),
+                    scale(coordinates[vertex].second, min_y, max_y)),
+        vertex);
+  }
+  std::sort(keys.begin(), keys.end());
+  old_id.resize(coordinates.size());
+  for (int i = 0; i < keys.size(); ++i) {
+    old_id[i] = keys[i].second;
+  }
+}
+
+Graph reorder(const Graph& graph,
+              const vector<int>& old_id,
+              vector<int>& new_id) {
+  assert(old_id.size() == graph.size());
+  new_id.assign(graph.size(), -1);
+  for (int vertex = 0; vertex < old_id.size(); ++vertex) {
+    assert(new_id[old_id[vertex]] == -1);
+    new_id[old_id[vertex]] = vertex;
+  }
+
+  Graph reordered_graph(graph.size());
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    const vector<Arc>& arcs = graph[old_id[tail]];
+    reordered_graph[tail].reserve(arcs.size());
+    for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+      reordered_graph[tail].push_back(Arc(new_id[arcs[arc_index].head],
+                                          arcs[arc_index].weight));
+    }
+  }
+  return reordered_graph;
+}
+
+Graph reorder(const Graph& graph,
+              VertexOrder order,
+              vector<int>& old_id,
+              vector<int>& new_id) {
+  vertex_order(graph, order, old_id);
+  return reorder(graph, old_id, new_id);
+}
@@ -0,0 +1,142 @@
+#include "graph/residual_network.h"
+
+#include <vector>
+
+#include "graph/common.h"
+#include "graph/csr.h"
+
+using std::vector;
+
+ResidualNetwork::ResidualNetwork(const Graph& graph) {
+  vector<int> forward_arcs;
+  initialize(graph, forward_arcs);
+}
+
+// same layout as initialize() builds, read straight from arrays
+ResidualNetwork::ResidualNetwork(const CsrGraph& graph) {
+  offsets_.assign(graph.size() + 1, 0);
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    offsets_[tail + 1] += graph.arcs_end(tail) - graph.arcs_begin(tail);
+    for (int arc_index = graph.arcs_begin(tail);
+         arc_index < graph.arcs_end(tail);
+         ++arc_index) {
+      ++offsets_[graph.head(arc_index) + 1];
+    }
+  }
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    offsets_[vertex + 1] += offsets_[vertex];
+  }
+
+  int arcs_count = offsets_[graph.size()];
+  heads_.resize(arcs_count);
+  reverse_arcs_.resize(arcs_count);
+  capacities_.resize(arcs_count);
+
+  vector<int> next_arc(offsets_.begin(), offsets_.end() - 1);
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = graph.arcs_begin(tail);
+         arc_index < graph.arcs_end(tail);
+         ++arc_index) {
+      int head = graph.head(arc_index);
+      int forward_arc = next_arc[tail]++;
+      int backward_arc = next_arc[head]++;
+      heads_[forward_arc] = head;
+      heads_[backward_arc] = tail;
+      reverse_arcs_[forward_arc] = backward_arc;
+      reverse_arcs_[backward_arc] = forward_arc;
+      capacities_[forward_arc] = graph.weight(arc_index);
+    }
+  }
+  residual_capacities_ = capacities_;
+}
+
+ResidualNetwork::ResidualNetwork(const CostGraph& graph) {
+  Graph capacities(graph.size());
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const CostArc& arc = graph[tail][arc_index];
+      capacities[tail].push_back(Arc(arc.head, arc.capacity));
+    }
+  }
+  vector<int> forward_arcs;
+  initialize(capacities, forward_arcs);
+
+  costs_.resize(arcs_count());
+  int arc_id = 0;
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      int forward_arc = forward_arcs[arc_id++];
+      costs_[forward_arc] = graph[tail][arc_index].cost;
+      costs_[reverse_arcs_[forward_arc]] = -graph[tail][arc_index].cost;
+    }
+  }
+}
+
+void ResidualNetwork::initialize(const Graph& graph,
+                                 vector<int>& forward_arcs) {
+  offsets_.assign(graph.size() + 1, 0);
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      ++offsets_[tail + 1];
+      ++offsets_[graph[tail][arc_index].head + 1];
+    }
+  }
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    offsets_[vertex + 1] += offsets_[vertex];
+  }
+
+  int arcs_count = offsets_[graph.size()];
+  heads_.resize(arcs_count);
+  reverse_arcs_.resize(arcs_count);
+  capacities_.resize(arcs_count);
+
+  vector<int> next_arc(offsets_.begin(), offsets_.end() - 1);
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      int forward_arc = next_arc[tail]++;
+      int backward_arc = next_arc[arc.head]++;
+      forward_arcs.push_back(forward_arc);
+      heads_[forward_arc] = arc.head;
+      heads_[backward_arc] = tail;
+      reverse_arcs_[forward_arc] = backward_arc;
+      reverse_arcs_[backward_arc] = forward_arc;
+      capacities_[forward_arc] = arc.weight;
+    }
+  }
+  residual_capacities_ = capacities_;
+}
+
+int ResidualNetwork::extract_flow(int source, Graph& flow) const {
+  flow.assign(size(), vector<Arc>());
+  for (int tail = 0; tail < size(); ++tail) {
+    for (int arc_index = arcs_begin(tail);
+         arc_index < arcs_end(tail);
+         ++arc_index) {
+      int arc_flow = capacities_[arc_index] - residual_capacities_[arc_index];
+      if (arc_flow > 0) {
+        flow[tail].push_back(Arc(heads_[arc_index], arc_flow));
+      }
+    }
+  }
+
+  // flow may return to source by arcs into it
+  int flow_value = 0;
+  for (int arc_index = arcs_begin(source);
+       arc_index < arcs_end(source);
+       ++arc_index) {
+    flow_value += capacities_[arc_index] - residual_capacities_[arc_index];
+  }
+  return flow_value;
+}
+
+long long ResidualNetwork::flow_cost() const {
+  long long cost = 0;
+  for (int arc_index = 0; arc_index < arcs_count(); ++arc_index) {
+    int arc_flow = capacities_[arc_index] - residual_capacities_[arc_index];
+    if (arc_flow > 0) {
+      cost += static_cast<long long>(arc_flow) * costs_[arc_index];
+    }
+  }
+  return cost;
+}
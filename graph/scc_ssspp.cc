@@ -0,0 +1,171 @@
+#include <vector>
+#include <queue>
+
+#include "graph/common.h"
+#include "graph/components.h"
+#include "graph/heap.h"
+#include "graph/ssspp.h"
+
+using std::vector;
+using std::queue;
+
+namespace {
+
+// Bellman-Ford on queue over arcs inside component, seeded by its
+// reached vertices. Path inside component of at least its size arcs
+// means negative cycle, then returns false.
+bool ford_bellman_in_component(const Graph& graph,
+                               const vector<int>& component,
+                               const int* vertices_begin,
+                               const int* vertices_end,
+                               vector<int>& distance,
+                               vector<int>& color,
+                               vector<int>& path_length) {
+  int component_size = vertices_end - vertices_begin;
+  queue<int> active_vertices;
+  for (const int* vertex = vertices_begin; vertex != vertices_end; ++vertex) {
+    if (distance[*vertex] != INFINITY) {
+      color[*vertex] = GRAY;
+      active_vertices.push(*vertex);
+    }
+  }
+
+  while (!active_vertices.empty()) {
+    int tail = active_vertices.front();
+    active_vertices.pop();
+    color[tail] = BLACK;
+
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      if (component[arc.head] != component[tail] ||
+          distance[arc.head] <= distance[tail] + arc.weight) {
+        continue;
+      }
+      distance[arc.head] = distance[tail] + arc.weight;
+      path_length[arc.head] = path_length[tail] + 1;
+      if (path_length[arc.head] >= component_size) {
+        return false;
+      }
+      if (color[arc.head] != GRAY) {
+        color[arc.head] = GRAY;
+        active_vertices.push(arc.head);
+      }
+    }
+  }
+  return true;
+}
+
+// Dijkstra over arcs inside component, seeded by its reached vertices
+void dijkstra_in_component(const Graph& graph,
+                           const vector<int>& component,
+                           const int* vertices_begin,
+                           const int* vertices_end,
+                           vector<int>& distance,
+                           vector<int>& color,
+                           GraphKaryHeap<int, 4>& active_vertices) {
+  for (const int* vertex = vertices_begin; vertex != vertices_end; ++vertex) {
+    if (distance[*vertex] != INFINITY) {
+      color[*vertex] = GRAY;
+      active_vertices.push(*vertex, distance[*vertex]);
+    }
+  }
+
+  while (!active_vertices.empty()) {
+    int tail = active_vertices.top();
+    active_vertices.pop();
+    color[tail] = BLACK;
+
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      if (component[arc.head] != component[tail] ||
+          color[arc.head] == BLACK ||
+          distance[arc.head] <= distance[tail] + arc.weight) {
+        continue;
+      }
+      distance[arc.head] = distance[tail] + arc.weight;
+      if (color[arc.head] == WHITE) {
+        color[arc.head] = GRAY;
+        active_vertices.push(arc.head, distance[arc.head]);
+      } else {
+        active_vertices.decrease_key(arc.head, distance[arc.head]);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+bool scc_ssspp(const Graph& graph,
+               int source,
+               vector<int>& distance) {
+  vector<int> component;
+  int components_count = strongly_connected_components(graph, component);
+  vector<int> offsets;
+  vector<int> vertices;
+  group_by_components(component, components_count, offsets, vertices);
+
+  distance.assign(graph.size(), INFINITY);
+  distance[source] = 0;
+  vector<int> color(graph.size(), WHITE);
+  vector<int> path_length(graph.size(), 0);
+  GraphKaryHeap<int, 4> active_vertices(graph.size());
+
+  // components before component of source are not reachable
+  for (int current = component[source];
+       current < components_count;
+       ++current) {
+    const int* vertices_begin = &vertices[0] + offsets[current];
+    const int* vertices_end = &vertices[0] + offsets[current + 1];
+
+    bool reached = false;
+    bool has_inner_arcs = false;
+    bool has_negative_inner_arcs = false;
+    for (const int* vertex = vertices_begin;
+         vertex != vertices_end;
+         ++vertex) {
+      reached |= distance[*vertex] != INFINITY;
+      const vector<Arc>& arcs = graph[*vertex];
+      for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+        if (component[arcs[arc_index].head] == current) {
+          has_inner_arcs = true;
+          has_negative_inner_arcs |= arcs[arc_index].weight < 0;
+        }
+      }
+    }
+    if (!reached) {
+      continue;
+    }
+
+    // acyclic parts of graph need no search at all
+    if (has_negative_inner_arcs) {
+      if (!ford_bellman_in_component(graph, component,
+                                     vertices_begin, vertices_end,
+                                     distance, color, path_length)) {
+        return false;
+      }
+    } else if (has_inner_arcs) {
+      dijkstra_in_component(graph, component,
+                            vertices_begin, vertices_end,
+                            distance, color, active_vertices);
+    }
+
+    // relax arcs to next components
+    for (const int* vertex = vertices_begin;
+         vertex != vertices_end;
+         ++vertex) {
+      if (distance[*vertex] == INFINITY) {
+        continue;
+      }
+      const vector<Arc>& arcs = graph[*vertex];
+      for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+        const Arc& arc = arcs[arc_index];
+        if (component[arc.head] != current &&
+            distance[arc.head] > distance[*vertex] + arc.weight) {
+          distance[arc.head] = distance[*vertex] + arc.weight;
+        }
+      }
+    }
+  }
+
+  return true;
+}
@@ -0,0 +1,101 @@
+#include "graph/shortest_path_workspace.h"
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include "graph/common.h"
+#include "graph/heap.h"
+
+using std::vector;
+
+ShortestPathWorkspace::ShortestPathWorkspace(int vertices_count)
+    : current_epoch_(0),
+      heap_(0),
+      heap_keys_count_(0),
+      queue_begin_(0),
+      queue_size_(0) {
+  reset(vertices_count);
+}
+
+void ShortestPathWorkspace::reset(int vertices_count) {
+  if (vertices_count != size()) {
+    epoch_.assign(vertices_count, 0);
+    current_epoch_ = 0;
+    distance_.resize(vertices_count);
+    color_.resize(vertices_count);
+    parent_.resize(vertices_count);
+    // reallocated on first use
+    next_in_tree_.clear();
+    previous_in_tree_.clear();
+    depth_in_tree_.clear();
+    queue_.clear();
+    touched_vertices_.clear();
+  }
+
+  ++current_epoch_;
+  if (current_epoch_ == 0) {
+    // epoch counter wrapped around, old stamps may look actual
+    epoch_.assign(vertices_count, 0);
+    current_epoch_ = 1;
+  }
+
+  touched_vertices_.clear();
+  heap_.clear();
+  queue_begin_ = 0;
+  queue_size_ = 0;
+}
+
+void ShortestPathWorkspace::allocate_heap() {
+  heap_ = GraphKaryHeap<int, 4>(size());
+  heap_keys_count_ = size();
+}
+
+void ShortestPathWorkspace::allocate_tree() {
+  next_in_tree_.assign(size(), -1);
+  previous_in_tree_.assign(size(), -1);
+  depth_in_tree_.assign(size(), 0);
+}
+
+void ShortestPathWorkspace::get_distances(vector<int>& distance) const {
+  distance.assign(size(), INFINITY);
+  for (int i = 0; i < touched_vertices_.size(); ++i) {
+    distance[touched_vertices_[i]] = distance_[touched_vertices_[i]];
+  }
+}
+
+void ShortestPathWorkspace::get_path(int destination,
+                                     vector<int>& path) const {
+  path.clear();
+  if (distance(destination) == INFINITY) {
+    return;
+  }
+  for (int vertex = destination; vertex != -1; vertex = parent(vertex)) {
+    path.push_back(vertex);
+  }
+  std::reverse(path.begin(), path.end());
+}
+
+void ShortestPathWorkspace::enqueue(int vertex) {
+  if (queue_.size() != size()) {
+    queue_.resize(size());
+  }
+  assert(queue_size_ < queue_.size());
+  int position = queue_begin_ + queue_size_;
+  if (position >= queue_.size()) {
+    position -= queue_.size();
+  }
+  queue_[position] = vertex;
+  ++queue_size_;
+}
+
+int ShortestPathWorkspace::dequeue() {
+  assert(!queue_empty());
+  int vertex = queue_[queue_begin_];
+  ++queue_begin_;
+  if (queue_begin_ == queue_.size()) {
+    queue_begin_ = 0;
+  }
+  --queue_size_;
+  return vertex;
+}
@@ -0,0 +1,225 @@
+#include "graph/spanning_forest.h"
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <limits>
+
+#include "basic/dsu.h"
+#include "graph/common.h"
+#include "graph/threads.h"
+
+using std::vector;
+using std::pair;
+using std::make_pair;
+
+// arcs are numbered in order of tails, arcs of tail
+// get numbers [offsets[tail], offsets[tail + 1])
+void get_arc_offsets(const Graph& graph, vector<int>& offsets) {
+  offsets.assign(graph.size() + 1, 0);
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    offsets[tail + 1] = offsets[tail] + graph[tail].size();
+  }
+}
+
+// order of signed weights kept by unsigned keys
+unsigned int weight_key(int weight) {
+  return static_cast<unsigned int>(weight) ^ 0x80000000u;
+}
+
+const int RADIX_BITS = 16;
+const int RADIX = 1 << RADIX_BITS;
+
+// stable LSD radix sort of arc numbers by weight keys, two passes
+void sort_arcs_by_weight(const vector<unsigned int>& keys,
+                         vector<int>& arcs) {
+  arcs.resize(keys.size());
+  for (int arc = 0; arc < keys.size(); ++arc) {
+    arcs[arc] = arc;
+  }
+  vector<int> sorted_arcs(keys.size());
+  vector<int> counts(RADIX + 1);
+  for (int shift = 0; shift < 32; shift += RADIX_BITS) {
+    std::fill(counts.begin(), counts.end(), 0);
+    for (int i = 0; i < arcs.size(); ++i) {
+      ++counts[((keys[arcs[i]] >> shift) & (RADIX - 1)) + 1];
+    }
+    for (int digit = 0; digit < RADIX; ++digit) {
+      counts[digit + 1] += counts[digit];
+    }
+    for (int i = 0; i < arcs.size(); ++i) {
+      sorted_arcs[counts[(keys[arcs[i]] >> shift) & (RADIX - 1)]++] = arcs[i];
+    }
+    arcs.swap(sorted_arcs);
+  }
+}
+
+long long kruskal(const Graph& graph, vector< pair<int, int> >& forest) {
+  vector<int> offsets;
+  get_arc_offsets(graph, offsets);
+  int arcs_count = offsets[graph.size()];
+
+  vector<unsigned int> keys(arcs_count);
+  vector<int> tails(arcs_count);
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      keys[offsets[tail] + arc_index] =
+          weight_key(graph[tail][arc_index].weight);
+      tails[offsets[tail] + arc_index] = tail;
+    }
+  }
+  vector<int> sorted_arcs;
+  sort_arcs_by_weight(keys, sorted_arcs);
+
+  forest.clear();
+  long long forest_weight = 0;
+  CompactDisjointSetUnion dsu(graph.size());
+  for (int i = 0; i < arcs_count && dsu.get_components_count() > 1; ++i) {
+    int tail = tails[sorted_arcs[i]];
+    int arc_index = sorted_arcs[i] - offsets[tail];
+    const Arc& arc = graph[tail][arc_index];
+    if (dsu.unite(tail, arc.head)) {
+      forest.push_back(make_pair(tail, arc_index));
+      forest_weight += arc.weight;
+    }
+  }
+  return forest_weight;
+}
+
+// threads take vertices by chunks of this size
+const int BORUVKA_CHUNK_SIZE = 1024;
+const unsigned long long NO_ARC =
+    std::numeric_limits<unsigned long long>::max();
+
+// Each round has two runs over chunks of vertices. First one finds
+// lightest arc of every component, candidates are packed with weight
+// in high bits and arc number in low bits, so atomic min of them
+// breaks ties by arc number and chosen arcs make no cycles. Second one
+// unites components by chosen arcs, arc chosen from both sides is
+// taken once since the second unite fails. Rounds go while some
+// components get united.
+class ParallelBoruvka {
+ public:
+  ParallelBoruvka(const Graph& graph, int threads_count);
+
+  void run(int thread_index);
+  long long solve(vector< pair<int, int> >& forest);
+ private:
+  enum Phase {
+    FIND_LIGHTEST_ARCS,
+    UNITE_COMPONENTS
+  };
+
+  void find_lightest_arcs(int tail);
+  void unite_component(int root, int thread_index);
+
+  const Graph& graph_;
+  int threads_count_;
+  vector<int> offsets_;
+  ConcurrentDisjointSetUnion dsu_;
+  // lightest arc key of root of component
+  vector<unsigned long long> lightest_arc_;
+
+  Phase phase_;
+  int next_vertex_;
+  int united_count_;
+  vector< vector< pair<int, int> > > thread_forests_;
+  vector<long long> thread_forest_weights_;
+};
+
+ParallelBoruvka::ParallelBoruvka(const Graph& graph, int threads_count)
+    : graph_(graph),
+      threads_count_(threads_count),
+      dsu_(graph.size()),
+      lightest_arc_(graph.size(), NO_ARC),
+      phase_(FIND_LIGHTEST_ARCS),
+      next_vertex_(0),
+      united_count_(0),
+      thread_forests_(threads_count),
+      thread_forest_weights_(threads_count, 0) {
+  get_arc_offsets(graph, offsets_);
+}
+
+void ParallelBoruvka::find_lightest_arcs(int tail) {
+  int tail_root = dsu_.get_root(tail);
+  for (int arc_index = 0; arc_index < graph_[tail].size(); ++arc_index) {
+    const Arc& arc = graph_[tail][arc_index];
+    int head_root = dsu_.get_root(arc.head);
+    if (head_root == tail_root) {
+      continue;
+    }
+    unsigned long long key =
+        (static_cast<unsigned long long>(weight_key(arc.weight)) << 32) |
+        static_cast<unsigned int>(offsets_[tail] + arc_index);
+    atomic_min(&lightest_arc_[tail_root], key);
+    atomic_min(&lightest_arc_[head_root], key);
+  }
+}
+
+// only roots of components of this round have arcs chosen,
+// roots may change meanwhile, but chosen arcs still make a forest
+void ParallelBoruvka::unite_component(int root, int thread_index) {
+  if (lightest_arc_[root] == NO_ARC) {
+    return;
+  }
+  int arc_number = static_cast<int>(lightest_arc_[root] & 0xffffffffULL);
+  lightest_arc_[root] = NO_ARC;
+
+  int tail = std::upper_bound(offsets_.begin(), offsets_.end(), arc_number) -
+      offsets_.begin() - 1;
+  int arc_index = arc_number - offsets_[tail];
+  const Arc& arc = graph_[tail][arc_index];
+  if (dsu_.unite(tail, arc.head)) {
+    thread_forests_[thread_index].push_back(make_pair(tail, arc_index));
+    thread_forest_weights_[thread_index] += arc.weight;
+    __sync_fetch_and_add(&united_count_, 1);
+  }
+}
+
+void ParallelBoruvka::run(int thread_index) {
+  while (true) {
+    int begin = __sync_fetch_and_add(&next_vertex_, BORUVKA_CHUNK_SIZE);
+    if (begin >= graph_.size()) {
+      break;
+    }
+    int end = std::min<int>(begin + BORUVKA_CHUNK_SIZE, graph_.size());
+
+    for (int vertex = begin; vertex < end; ++vertex) {
+      if (phase_ == FIND_LIGHTEST_ARCS) {
+        find_lightest_arcs(vertex);
+      } else {
+        unite_component(vertex, thread_index);
+      }
+    }
+  }
+}
+
+long long ParallelBoruvka::solve(vector< pair<int, int> >& forest) {
+  do {
+    phase_ = FIND_LIGHTEST_ARCS;
+    next_vertex_ = 0;
+    run_in_threads(*this, threads_count_);
+
+    phase_ = UNITE_COMPONENTS;
+    next_vertex_ = 0;
+    united_count_ = 0;
+    run_in_threads(*this, threads_count_);
+  } while (united_count_ > 0);
+
+  forest.clear();
+  long long forest_weight = 0;
+  for (int thread_index = 0; thread_index < threads_count_; ++thread_index) {
+    forest.insert(forest.end(),
+                  thread_forests_[thread_index].begin(),
+                  thread_forests_[thread_index].end());
+    forest_weight += thread_forest_weights_[thread_index];
+  }
+  return forest_weight;
+}
+
+long long boruvka(const Graph& graph,
+                  vector< pair<int, int> >& forest,
+                  int threads_count) {
+  ParallelBoruvka parallel_boruvka(graph, threads_count);
+  return parallel_boruvka.solve(forest);
+}
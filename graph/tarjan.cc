@@ -1,88 +1,99 @@
 #include <vector>
-#include <queue>
 #include <iostream>
-#include <utility>
 #include <algorithm>
-#include <list>
 
 #include "graph/common.h"
+#include "graph/ssspp.h"
+#include "graph/shortest_path_workspace.h"
 
 using std::vector;
-using std::queue;
 using std::cout;
 using std::endl;
-using std::pair;
-using std::make_pair;
-using std::list;
 
+// drops shortest paths subtree of root from tree, fails if it
+// contains checked; vertices of subtree but root lose their parents
 bool check_and_destroy(int root, int checked,
-                       vector< list<int> >& children,
-                       vector< pair<int, list<int>::iterator> >& parent,
-                       vector<bool>& actual) {
+                       ShortestPathWorkspace& workspace) {
   if (root == checked) {
     return false;
   }
 
-  for (list<int>::iterator child_iterator = children[root].begin();
-       child_iterator != children[root].end();
-       ++child_iterator) {
-    int child = *child_iterator;
-    actual[child] = false;
-    parent[child] = make_pair(-1, list<int>::iterator());
-    if (!check_and_destroy(child, checked, children, parent, actual)) {
+  int root_depth = workspace.depth_in_tree(root);
+  int vertex = workspace.next_in_tree(root);
+  while (vertex != -1 && workspace.depth_in_tree(vertex) > root_depth) {
+    if (vertex == checked) {
       return false;
     }
+    workspace.set_parent(vertex, -1);
+    vertex = workspace.next_in_tree(vertex);
+  }
+
+  int previous = workspace.previous_in_tree(root);
+  if (previous != -1) {
+    workspace.next_in_tree(previous) = vertex;
+  }
+  if (vertex != -1) {
+    workspace.previous_in_tree(vertex) = previous;
   }
-  children[root].clear();
   return true;
 }
 
+// puts vertex into tree as the first child of parent
+void attach(int vertex, int parent, ShortestPathWorkspace& workspace) {
+  int next = workspace.next_in_tree(parent);
+  workspace.next_in_tree(vertex) = next;
+  workspace.previous_in_tree(vertex) = parent;
+  if (next != -1) {
+    workspace.previous_in_tree(next) = vertex;
+  }
+  workspace.next_in_tree(parent) = vertex;
+  workspace.depth_in_tree(vertex) = workspace.depth_in_tree(parent) + 1;
+  workspace.set_parent(vertex, parent);
+}
+
 bool tarjan_ssspp(const Graph& graph,
                   int source,
                   vector<int>& distance) {
-  distance.assign(graph.size(), INFINITY);
-  distance[source] = 0;
-
-  vector<int> color(graph.size(), WHITE);
-  color[source] = GRAY;
-
-  vector< list<int> > children(graph.size());
-  vector< pair<int, list<int>::iterator> >
-      parent(graph.size(), make_pair(-1, list<int>::iterator()));
+  ShortestPathWorkspace workspace(graph.size());
+  bool result = tarjan_ssspp(graph, source, workspace);
+  workspace.get_distances(distance);
+  return result;
+}
 
-  vector<bool> actual(graph.size());
-  actual[source] = true;
-  
-  queue<int> active_vertices;
-  active_vertices.push(source);
+// vertex is actual if it is source or it is in shortest paths tree,
+// i.e. has parent; distances of not actual vertices are not relaxed
+bool tarjan_ssspp(const Graph& graph,
+                  int source,
+                  ShortestPathWorkspace& workspace) {
+  workspace.reset(graph.size());
+  workspace.set_distance(source, 0);
+  workspace.set_color(source, GRAY);
+  workspace.enqueue(source);
 
-  while (!active_vertices.empty()) {
-    int tail = active_vertices.front();
-    active_vertices.pop();
+  while (!workspace.queue_empty()) {
+    int tail = workspace.dequeue();
 
-    if (actual[tail]) {
+    if (tail == source || workspace.parent(tail) != -1) {
       for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
         const Arc& arc = graph[tail][arc_index];
-        if (distance[arc.head] > distance[tail] + arc.weight) {
-          if (!check_and_destroy(arc.head, tail, children, parent, actual)) {
+        int candidate_distance = workspace.distance(tail) + arc.weight;
+        if (workspace.distance(arc.head) > candidate_distance) {
+          // vertex out of tree has no subtree
+          if ((arc.head == source || workspace.parent(arc.head) != -1) &&
+              !check_and_destroy(arc.head, tail, workspace)) {
             return false;
           }
-          
-          distance[arc.head] = distance[tail] + arc.weight;
-          if (parent[arc.head].first != -1) {
-            children[parent[arc.head].first].erase(parent[arc.head].second);
-          }
-          children[tail].push_back(arc.head);
-          parent[arc.head] = make_pair(tail, --children[tail].end());
-          actual[arc.head] = true;
-          if (color[arc.head] != GRAY) {
-            color[arc.head] = GRAY;
-            active_vertices.push(arc.head);
+
+          workspace.set_distance(arc.head, candidate_distance);
+          attach(arc.head, tail, workspace);
+          if (workspace.color(arc.head) != GRAY) {
+            workspace.set_color(arc.head, GRAY);
+            workspace.enqueue(arc.head);
           }
         }
       }
     }
-    color[tail] = BLACK;
+    workspace.set_color(tail, BLACK);
   }
 
   return true;
@@ -0,0 +1,164 @@
+#include "graph/alt.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/ssspp.h"
+#include "graph/ut/test_utils.h"
+
+using std::vector;
+
+const LandmarkSelection SELECTIONS[] = {
+  RANDOM_LANDMARKS,
+  FARTHEST_LANDMARKS,
+  AVOID_LANDMARKS
+};
+const int SELECTIONS_COUNT = sizeof(SELECTIONS) / sizeof(SELECTIONS[0]);
+
+TEST(AltTest, Simplest) {
+  Graph graph(3);
+  graph[0].push_back(Arc(1, 1));
+  graph[1].push_back(Arc(2, 1));
+  graph[0].push_back(Arc(2, 5));
+
+  for (int selection = 0; selection < SELECTIONS_COUNT; ++selection) {
+    AltIndex index(graph, 2, SELECTIONS[selection]);
+    EXPECT_EQ(2, index.query(0, 2));
+    EXPECT_EQ(2, index.bidirectional_query(0, 2));
+    EXPECT_EQ(0, index.query(1, 1));
+    EXPECT_EQ(0, index.bidirectional_query(1, 1));
+    EXPECT_EQ(INFINITY, index.query(2, 0));
+    EXPECT_EQ(INFINITY, index.bidirectional_query(2, 0));
+  }
+}
+
+TEST(AltTest, LowerBound) {
+  const int VERTICES_COUNT = 100;
+  const int ARCS_COUNT = 3 * VERTICES_COUNT;
+  srand(42);
+
+  Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+  AltIndex index(graph, 4, AVOID_LANDMARKS);
+  ASSERT_EQ(4, index.landmarks().size());
+
+  for (int source = 0; source < VERTICES_COUNT; ++source) {
+    vector<int> distance;
+    dijkstra_on_kary_heap<2>(graph, source, distance);
+    for (int destination = 0; destination < VERTICES_COUNT; ++destination) {
+      int bound = index.lower_bound(source, destination);
+      ASSERT_LE(bound, distance[destination]);
+      if (distance[destination] != INFINITY) {
+        ASSERT_LE(0, bound);
+      }
+    }
+  }
+}
+
+TEST(AltTest, SourceDestination) {
+  for (int vertices_count = 1; vertices_count < 10; ++vertices_count) {
+    for (int arcs_count = 0;
+         arcs_count < vertices_count * (vertices_count - 1);
+         ++arcs_count) {
+      Graph graph = generate_random_graph(vertices_count, arcs_count);
+      for (int selection = 0; selection < SELECTIONS_COUNT; ++selection) {
+        AltIndex index(graph, 2, SELECTIONS[selection]);
+
+        for (int source = 0; source < vertices_count; ++source) {
+          vector<int> distance;
+          dijkstra_on_kary_heap<2>(graph, source, distance);
+          for (int destination = 0;
+               destination < vertices_count;
+               ++destination) {
+            ASSERT_EQ(distance[destination],
+                      index.query(source, destination));
+            ASSERT_EQ(distance[destination],
+                      index.bidirectional_query(source, destination));
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(AltTest, Stress) {
+  const int TEST_COUNT = 10;
+  const int VERTICES_COUNT = 300;
+  const int ARCS_COUNT = 3 * VERTICES_COUNT;
+  const int QUERIES_COUNT = 100;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+    AltIndex index(graph, 8, SELECTIONS[test % SELECTIONS_COUNT]);
+
+    for (int query = 0; query < QUERIES_COUNT; ++query) {
+      int source = rand() % VERTICES_COUNT;
+      int destination = rand() % VERTICES_COUNT;
+      int shortest_path = bidirected_dijkstra(graph, source, destination);
+      ASSERT_EQ(shortest_path, index.query(source, destination));
+      ASSERT_EQ(shortest_path, index.bidirectional_query(source, destination));
+    }
+  }
+}
+
+TEST(AltTest, Grid) {
+  const int SIDE = 20;
+  const int QUERIES_COUNT = 1000;
+  srand(42);
+
+  Graph graph = generate_grid_graph(SIDE);
+  for (int selection = 0; selection < SELECTIONS_COUNT; ++selection) {
+    AltIndex index(graph, 8, SELECTIONS[selection]);
+    for (int query = 0; query < QUERIES_COUNT; ++query) {
+      int source = rand() % graph.size();
+      int destination = rand() % graph.size();
+      int shortest_path = bidirected_dijkstra(graph, source, destination);
+      ASSERT_EQ(shortest_path, index.query(source, destination));
+      ASSERT_EQ(shortest_path, index.bidirectional_query(source, destination));
+    }
+  }
+}
+
+// Compares search space of bidirected Dijkstra and ALT
+// with different landmark selection strategies on road-like graph.
+TEST(AltTest, SettledVerticesMaxTest) {
+  const int SIDE = 50;
+  const int LANDMARKS_COUNT = 16;
+  const int QUERIES_COUNT = 1000;
+  const char* SELECTION_NAMES[] = {"random", "farthest", "avoid"};
+  srand(42);
+
+  Graph graph = generate_grid_graph(SIDE);
+  vector<int> sources(QUERIES_COUNT);
+  vector<int> destinations(QUERIES_COUNT);
+  long long dijkstra_settled = 0;
+  for (int query = 0; query < QUERIES_COUNT; ++query) {
+    sources[query] = rand() % graph.size();
+    destinations[query] = rand() % graph.size();
+    int settled_vertices_count;
+    bidirected_dijkstra(graph, sources[query], destinations[query],
+                        settled_vertices_count);
+    dijkstra_settled += settled_vertices_count;
+  }
+  std::cout << "bidirected dijkstra: "
+            << dijkstra_settled / QUERIES_COUNT << " settled" << std::endl;
+
+  for (int selection = 0; selection < SELECTIONS_COUNT; ++selection) {
+    AltIndex index(graph, LANDMARKS_COUNT, SELECTIONS[selection]);
+    long long settled = 0;
+    long long bidirectional_settled = 0;
+    for (int query = 0; query < QUERIES_COUNT; ++query) {
+      index.query(sources[query], destinations[query]);
+      settled += index.settled_vertices_count();
+      index.bidirectional_query(sources[query], destinations[query]);
+      bidirectional_settled += index.settled_vertices_count();
+    }
+    std::cout << SELECTION_NAMES[selection] << " landmarks: "
+              << settled / QUERIES_COUNT << " settled, bidirectional "
+              << bidirectional_settled / QUERIES_COUNT << " settled"
+              << std::endl;
+  }
+}
@@ -7,6 +7,7 @@
 
 #include "gtest/gtest.h"
 
+#include "graph/generators.h"
 #include "graph/ssspp.h"
 
 using std::cout;
@@ -48,3 +49,160 @@ TEST(APSPPTest, Johnson) {
     }
   }
 }
+
+TEST(APSPPTest, ParallelJohnson) {
+  for (int vertices_count = 1; vertices_count < 10; ++vertices_count) {
+    for (int arcs_count = 0;
+         arcs_count < vertices_count * (vertices_count - 1);
+         ++arcs_count) {
+      Graph graph = generate_random_graph(vertices_count, arcs_count);
+      vector< vector<int> > shortest_paths_by_floyd;
+      floyd(graph, shortest_paths_by_floyd);
+
+      for (int threads_count = 1; threads_count <= 3; ++threads_count) {
+        vector< vector<int> > shortest_paths_by_johnson;
+        parallel_johnson(graph, shortest_paths_by_johnson, threads_count);
+        ASSERT_EQ(shortest_paths_by_floyd, shortest_paths_by_johnson);
+      }
+    }
+  }
+}
+
+TEST(APSPPTest, ParallelJohnsonNegativeArcs) {
+  Graph graph(4);
+  graph[0].push_back(Arc(1, 1));
+  graph[0].push_back(Arc(2, 3));
+  graph[1].push_back(Arc(3, 1));
+  graph[2].push_back(Arc(3, -10));
+  graph[3].push_back(Arc(0, 8));
+
+  vector< vector<int> > shortest_paths_by_floyd;
+  floyd(graph, shortest_paths_by_floyd);
+
+  vector< vector<int> > shortest_paths_by_johnson;
+  parallel_johnson(graph, shortest_paths_by_johnson, 2);
+  EXPECT_EQ(shortest_paths_by_floyd, shortest_paths_by_johnson);
+}
+
+TEST(APSPPTest, JohnsonNegativeCycle) {
+  Graph graph(4);
+  graph[0].push_back(Arc(1, 1));
+  graph[1].push_back(Arc(2, -3));
+  graph[2].push_back(Arc(1, 1));
+  graph[2].push_back(Arc(3, 1));
+
+  vector< vector<int> > shortest_paths;
+  EXPECT_FALSE(johnson(graph, shortest_paths));
+  EXPECT_TRUE(shortest_paths.empty());
+  EXPECT_FALSE(parallel_johnson(graph, shortest_paths, 2));
+  EXPECT_TRUE(shortest_paths.empty());
+  EXPECT_FALSE(johnson(CsrGraph(graph), shortest_paths));
+  EXPECT_TRUE(shortest_paths.empty());
+
+  graph[2][0].weight = 3;
+  ASSERT_TRUE(johnson(graph, shortest_paths));
+  EXPECT_EQ(-1, shortest_paths[0][3]);
+}
+
+TEST(APSPPTest, BlockedFloyd) {
+  for (int vertices_count = 1; vertices_count < 10; ++vertices_count) {
+    for (int arcs_count = 0;
+         arcs_count < vertices_count * (vertices_count - 1);
+         ++arcs_count) {
+      Graph graph = generate_random_graph(vertices_count, arcs_count);
+      vector< vector<int> > shortest_paths_by_floyd;
+      floyd(graph, shortest_paths_by_floyd);
+
+      vector< vector<int> > shortest_paths_by_blocked_floyd;
+      blocked_floyd(graph, shortest_paths_by_blocked_floyd, 2);
+
+      ASSERT_EQ(shortest_paths_by_floyd, shortest_paths_by_blocked_floyd);
+    }
+  }
+}
+
+TEST(APSPPTest, BlockedFloydStress) {
+  const int TEST_COUNT = 20;
+  const int MAX_VERTICES_COUNT = 200;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 1;
+    int arcs_count = rand() % (5 * vertices_count);
+    int threads_count = rand() % 4 + 1;
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+
+    vector< vector<int> > shortest_paths_by_floyd;
+    floyd(graph, shortest_paths_by_floyd);
+
+    vector< vector<int> > shortest_paths_by_blocked_floyd;
+    blocked_floyd(graph, shortest_paths_by_blocked_floyd, threads_count);
+
+    ASSERT_EQ(shortest_paths_by_floyd, shortest_paths_by_blocked_floyd);
+  }
+}
+
+const int FLOYD_THREADS_COUNT = 4;
+
+void floyd_max_test(int vertices_count) {
+  srand(42);
+  Graph graph = generate_random_graph(vertices_count, 10 * vertices_count);
+  vector< vector<int> > shortest_paths;
+  floyd(graph, shortest_paths);
+}
+
+void blocked_floyd_max_test(int vertices_count) {
+  srand(42);
+  Graph graph = generate_random_graph(vertices_count, 10 * vertices_count);
+  vector< vector<int> > shortest_paths;
+  blocked_floyd(graph, shortest_paths, FLOYD_THREADS_COUNT);
+}
+
+TEST(APSPPTest, Floyd500MaxTest) {
+  floyd_max_test(500);
+}
+
+TEST(APSPPTest, BlockedFloyd500MaxTest) {
+  blocked_floyd_max_test(500);
+}
+
+TEST(APSPPTest, BlockedFloyd1kMaxTest) {
+  blocked_floyd_max_test(1000);
+}
+
+const int JOHNSON_VERTICES_COUNT = 1000;
+const int JOHNSON_ARCS_COUNT = 5 * JOHNSON_VERTICES_COUNT;
+
+TEST(APSPPTest, JohnsonMaxTest) {
+  srand(42);
+  Graph graph = generate_random_graph(JOHNSON_VERTICES_COUNT,
+                                      JOHNSON_ARCS_COUNT);
+  vector< vector<int> > shortest_paths;
+  johnson(graph, shortest_paths);
+}
+
+TEST(APSPPTest, ParallelJohnsonMaxTest) {
+  srand(42);
+  Graph graph = generate_random_graph(JOHNSON_VERTICES_COUNT,
+                                      JOHNSON_ARCS_COUNT);
+  vector< vector<int> > shortest_paths;
+  parallel_johnson(graph, shortest_paths, 4);
+}
+
+// Johnson on road-like and skewed graphs of the same size
+const int JOHNSON_ROAD_SIDE = 32;
+
+TEST(APSPPTest, JohnsonRoadMaxTest) {
+  Graph graph = generate_road_graph(JOHNSON_ROAD_SIDE, JOHNSON_ROAD_SIDE,
+                                    42, 1);
+  vector< vector<int> > shortest_paths;
+  johnson(graph, shortest_paths);
+}
+
+TEST(APSPPTest, JohnsonPowerLawMaxTest) {
+  Graph graph = generate_power_law_graph(
+      JOHNSON_ROAD_SIDE * JOHNSON_ROAD_SIDE,
+      4 * JOHNSON_ROAD_SIDE * JOHNSON_ROAD_SIDE, 2.5, 42, 1);
+  vector< vector<int> > shortest_paths;
+  johnson(graph, shortest_paths);
+}
@@ -0,0 +1,207 @@
+#include "graph/components.h"
+
+#include <vector>
+#include <queue>
+
+#include "gtest/gtest.h"
+
+using std::vector;
+
+// components by breadth first search over arcs in both directions
+int bfs_components(const Graph& graph, vector<int>& component) {
+  Graph inverted_graph = invert(graph);
+  component.assign(graph.size(), -1);
+  int components_count = 0;
+  for (int root = 0; root < graph.size(); ++root) {
+    if (component[root] != -1) {
+      continue;
+    }
+    std::queue<int> active_vertices;
+    active_vertices.push(root);
+    component[root] = components_count;
+    while (!active_vertices.empty()) {
+      int tail = active_vertices.front();
+      active_vertices.pop();
+      for (int direction = 0; direction < 2; ++direction) {
+        const vector<Arc>& arcs = direction == 0 ? graph[tail]
+                                                 : inverted_graph[tail];
+        for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+          int head = arcs[arc_index].head;
+          if (component[head] == -1) {
+            component[head] = components_count;
+            active_vertices.push(head);
+          }
+        }
+      }
+    }
+    ++components_count;
+  }
+  return components_count;
+}
+
+TEST(ComponentsTest, Simple) {
+  Graph graph(6);
+  graph[0].push_back(Arc(2, 1));
+  graph[3].push_back(Arc(2, 1));
+  graph[4].push_back(Arc(1, 1));
+
+  int expected_component[] = {0, 1, 0, 0, 1, 2};
+  for (int threads_count = 0; threads_count <= 2; ++threads_count) {
+    vector<int> component;
+    if (threads_count == 0) {
+      EXPECT_EQ(3, connected_components(graph, component));
+    } else {
+      EXPECT_EQ(3, connected_components(graph, component, threads_count));
+    }
+    EXPECT_EQ(vector<int>(expected_component, expected_component + 6),
+              component);
+  }
+}
+
+TEST(ComponentsTest, Stress) {
+  const int TEST_COUNT = 100;
+  const int MAX_VERTICES_COUNT = 5000;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 1;
+    int arcs_count = rand() % (2 * vertices_count);
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+
+    vector<int> expected_component;
+    int expected_count = bfs_components(graph, expected_component);
+
+    vector<int> component;
+    ASSERT_EQ(expected_count, connected_components(graph, component));
+    ASSERT_EQ(expected_component, component);
+    for (int threads_count = 1; threads_count <= 8; threads_count *= 2) {
+      ASSERT_EQ(expected_count,
+                connected_components(graph, component, threads_count));
+      ASSERT_EQ(expected_component, component);
+    }
+  }
+}
+
+const int COMPONENTS_VERTICES_COUNT = 1000000;
+const int COMPONENTS_ARCS_COUNT = COMPONENTS_VERTICES_COUNT;
+
+// threads count 0 runs serial union-find
+void components_max_test(int threads_count) {
+  srand(42);
+  Graph graph = generate_random_graph(COMPONENTS_VERTICES_COUNT,
+                                      COMPONENTS_ARCS_COUNT);
+  vector<int> component;
+  if (threads_count == 0) {
+    connected_components(graph, component);
+  } else {
+    connected_components(graph, component, threads_count);
+  }
+}
+
+TEST(ComponentsTest, SerialMaxTest) {
+  components_max_test(0);
+}
+
+TEST(ComponentsTest, Parallel1ThreadMaxTest) {
+  components_max_test(1);
+}
+
+TEST(ComponentsTest, Parallel2ThreadsMaxTest) {
+  components_max_test(2);
+}
+
+TEST(ComponentsTest, Parallel4ThreadsMaxTest) {
+  components_max_test(4);
+}
+
+TEST(ComponentsTest, Parallel8ThreadsMaxTest) {
+  components_max_test(8);
+}
+
+TEST(ComponentsTest, StronglyConnectedComponents) {
+  const int TEST_COUNT = 100;
+  const int MAX_VERTICES_COUNT = 50;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 2;
+    int arcs_count = rand() % (2 * vertices_count);
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+
+    // reachability by depth first search from every vertex
+    vector< vector<bool> > reachable(vertices_count,
+                                     vector<bool>(vertices_count, false));
+    for (int root = 0; root < vertices_count; ++root) {
+      vector<int> stack(1, root);
+      reachable[root][root] = true;
+      while (!stack.empty()) {
+        int tail = stack.back();
+        stack.pop_back();
+        for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+          int head = graph[tail][arc_index].head;
+          if (!reachable[root][head]) {
+            reachable[root][head] = true;
+            stack.push_back(head);
+          }
+        }
+      }
+    }
+
+    vector<int> component;
+    int components_count = strongly_connected_components(graph, component);
+    vector<bool> used(components_count, false);
+    for (int first = 0; first < vertices_count; ++first) {
+      ASSERT_LE(0, component[first]);
+      ASSERT_GT(components_count, component[first]);
+      used[component[first]] = true;
+      for (int second = 0; second < vertices_count; ++second) {
+        ASSERT_EQ(reachable[first][second] && reachable[second][first],
+                  component[first] == component[second]);
+      }
+      for (int arc_index = 0; arc_index < graph[first].size(); ++arc_index) {
+        ASSERT_LE(component[first], component[graph[first][arc_index].head]);
+      }
+    }
+    ASSERT_EQ(vector<bool>(components_count, true), used);
+
+    Graph dag = condensation(graph, component, components_count);
+    ASSERT_EQ(components_count, dag.size());
+    for (int tail = 0; tail < components_count; ++tail) {
+      for (int arc_index = 0; arc_index < dag[tail].size(); ++arc_index) {
+        ASSERT_LT(tail, dag[tail][arc_index].head);
+      }
+    }
+    for (int tail = 0; tail < vertices_count; ++tail) {
+      for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+        const Arc& arc = graph[tail][arc_index];
+        if (component[tail] == component[arc.head]) {
+          continue;
+        }
+        const vector<Arc>& arcs = dag[component[tail]];
+        int found = 0;
+        for (int i = 0; i < arcs.size(); ++i) {
+          if (arcs[i].head == component[arc.head]) {
+            ++found;
+            ASSERT_LE(arcs[i].weight, arc.weight);
+          }
+        }
+        ASSERT_EQ(1, found);
+      }
+    }
+  }
+}
+
+TEST(ComponentsTest, StronglyConnectedComponentsOfLongPath) {
+  // recursive search would run out of stack here
+  const int VERTICES_COUNT = 1000000;
+  Graph graph(VERTICES_COUNT);
+  for (int vertex = 0; vertex + 1 < VERTICES_COUNT; ++vertex) {
+    graph[vertex].push_back(Arc(vertex + 1, 1));
+  }
+  vector<int> component;
+  EXPECT_EQ(VERTICES_COUNT, strongly_connected_components(graph, component));
+  EXPECT_EQ(VERTICES_COUNT - 1, component.back());
+
+  graph.back().push_back(Arc(0, 1));
+  EXPECT_EQ(1, strongly_connected_components(graph, component));
+}
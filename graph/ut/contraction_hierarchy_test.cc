@@ -0,0 +1,220 @@
+#include "graph/contraction_hierarchy.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "graph/ssspp.h"
+#include "graph/ut/test_utils.h"
+
+using std::vector;
+
+TEST(ContractionHierarchyTest, Simplest) {
+  Graph graph(3);
+  graph[0].push_back(Arc(1, 1));
+  graph[1].push_back(Arc(2, 1));
+  graph[0].push_back(Arc(2, 5));
+
+  ContractionHierarchy hierarchy(graph);
+  EXPECT_EQ(2, hierarchy.query(0, 2));
+  EXPECT_EQ(0, hierarchy.query(1, 1));
+  EXPECT_EQ(INFINITY, hierarchy.query(2, 0));
+}
+
+TEST(ContractionHierarchyTest, SourceDestination) {
+  for (int vertices_count = 1; vertices_count < 10; ++vertices_count) {
+    for (int arcs_count = 0;
+         arcs_count < vertices_count * (vertices_count - 1);
+         ++arcs_count) {
+      Graph graph = generate_random_graph(vertices_count, arcs_count);
+      ContractionHierarchy hierarchy(graph);
+
+      for (int source = 0; source < vertices_count; ++source) {
+        vector<int> distance;
+        dijkstra_on_kary_heap<2>(graph, source, distance);
+        for (int destination = 0;
+             destination < vertices_count;
+             ++destination) {
+          ASSERT_EQ(distance[destination],
+                    hierarchy.query(source, destination));
+        }
+      }
+    }
+  }
+}
+
+TEST(ContractionHierarchyTest, Stress) {
+  const int TEST_COUNT = 10;
+  const int VERTICES_COUNT = 300;
+  const int ARCS_COUNT = 3 * VERTICES_COUNT;
+  const int QUERIES_COUNT = 100;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+    ContractionHierarchy hierarchy(graph);
+
+    for (int query = 0; query < QUERIES_COUNT; ++query) {
+      int source = rand() % VERTICES_COUNT;
+      int destination = rand() % VERTICES_COUNT;
+      ASSERT_EQ(bidirected_dijkstra(graph, source, destination),
+                hierarchy.query(source, destination));
+    }
+  }
+}
+
+TEST(ContractionHierarchyTest, DistanceTable) {
+  const int TEST_COUNT = 10;
+  const int VERTICES_COUNT = 300;
+  const int ARCS_COUNT = 3 * VERTICES_COUNT;
+  const int SOURCES_COUNT = 10;
+  const int TARGETS_COUNT = 15;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+    ContractionHierarchy hierarchy(graph);
+    vector<int> sources(SOURCES_COUNT);
+    for (int i = 0; i < SOURCES_COUNT; ++i) {
+      sources[i] = rand() % VERTICES_COUNT;
+    }
+    vector<int> targets(TARGETS_COUNT);
+    for (int i = 0; i < TARGETS_COUNT; ++i) {
+      targets[i] = rand() % VERTICES_COUNT;
+    }
+
+    vector<int> expected_table;
+    distance_table(graph, sources, targets, expected_table);
+    vector<int> table;
+    hierarchy.distance_table(sources, targets, table);
+    ASSERT_EQ(expected_table, table);
+  }
+}
+
+TEST(ContractionHierarchyTest, SaveAndLoad) {
+  const int VERTICES_COUNT = 100;
+  const int ARCS_COUNT = 3 * VERTICES_COUNT;
+  srand(42);
+
+  Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+  ContractionHierarchy hierarchy(graph);
+
+  try {
+    hierarchy.save("test.ch");
+    ContractionHierarchy loaded_hierarchy;
+    loaded_hierarchy.load("test.ch");
+    ASSERT_EQ(VERTICES_COUNT, loaded_hierarchy.size());
+
+    for (int source = 0; source < VERTICES_COUNT; ++source) {
+      EXPECT_EQ(hierarchy.rank(source), loaded_hierarchy.rank(source));
+      for (int destination = 0;
+           destination < VERTICES_COUNT;
+           ++destination) {
+        EXPECT_EQ(hierarchy.query(source, destination),
+                  loaded_hierarchy.query(source, destination));
+      }
+    }
+  } catch(const std::runtime_error& e) {
+    EXPECT_TRUE(false);
+  }
+
+  EXPECT_EQ(0, system("rm test.ch"));
+}
+
+TEST(ContractionHierarchyTest, LoadMissingFile) {
+  ContractionHierarchy hierarchy;
+  EXPECT_THROW(hierarchy.load("missing.ch"), std::runtime_error);
+}
+
+TEST(ContractionHierarchyTest, LoadCorruptedFile) {
+  Graph graph(3);
+  graph[0].push_back(Arc(1, 1));
+  graph[1].push_back(Arc(2, 1));
+  ContractionHierarchy hierarchy(graph);
+  hierarchy.save("test.ch");
+
+  // magic, version, vertices count, ranks, then arcs count
+  // of vertex 0 in upward graph
+  const int VERTICES_COUNT_POSITION = 2;
+  const int ARCS_COUNT_POSITION = 6;
+  ContractionHierarchy loaded_hierarchy;
+  loaded_hierarchy.load("test.ch");
+  write_corrupted_copy("test.ch", "corrupted.ch",
+                       VERTICES_COUNT_POSITION, 2000000000);
+  EXPECT_THROW(loaded_hierarchy.load("corrupted.ch"), std::runtime_error);
+  write_corrupted_copy("test.ch", "corrupted.ch",
+                       VERTICES_COUNT_POSITION + 1, 3);
+  EXPECT_THROW(loaded_hierarchy.load("corrupted.ch"), std::runtime_error);
+  write_corrupted_copy("test.ch", "corrupted.ch",
+                       ARCS_COUNT_POSITION, 2000000000);
+  EXPECT_THROW(loaded_hierarchy.load("corrupted.ch"), std::runtime_error);
+
+  // failed loads keep previous hierarchy
+  ASSERT_EQ(3, loaded_hierarchy.size());
+  EXPECT_EQ(2, loaded_hierarchy.query(0, 2));
+
+  std::remove("test.ch");
+  std::remove("corrupted.ch");
+}
+
+TEST(ContractionHierarchyTest, Grid) {
+  const int SIDE = 20;
+  const int QUERIES_COUNT = 1000;
+  srand(42);
+
+  Graph graph = generate_grid_graph(SIDE);
+  ContractionHierarchy hierarchy(graph);
+  for (int query = 0; query < QUERIES_COUNT; ++query) {
+    int source = rand() % graph.size();
+    int destination = rand() % graph.size();
+    ASSERT_EQ(bidirected_dijkstra(graph, source, destination),
+              hierarchy.query(source, destination));
+  }
+}
+
+// Two following tests answer the same queries on road-like graph,
+// compare their running times; query time of contraction hierarchy
+// is its running time minus time of BuildMaxTest.
+const int QUERY_GRID_SIDE = 50;
+const int QUERY_COUNT = 1000;
+
+TEST(ContractionHierarchyTest, BidirectedDijkstraQueryMaxTest) {
+  srand(42);
+  Graph graph = generate_grid_graph(QUERY_GRID_SIDE);
+  for (int query = 0; query < QUERY_COUNT; ++query) {
+    bidirected_dijkstra(graph, rand() % graph.size(), rand() % graph.size());
+  }
+}
+
+TEST(ContractionHierarchyTest, ContractionHierarchyQueryMaxTest) {
+  srand(42);
+  Graph graph = generate_grid_graph(QUERY_GRID_SIDE);
+  ContractionHierarchy hierarchy(graph);
+  for (int query = 0; query < QUERY_COUNT; ++query) {
+    hierarchy.query(rand() % graph.size(), rand() % graph.size());
+  }
+}
+
+TEST(ContractionHierarchyTest, ContractionHierarchyBuildMaxTest) {
+  srand(42);
+  Graph graph = generate_grid_graph(QUERY_GRID_SIDE);
+  ContractionHierarchy hierarchy(graph);
+}
+
+TEST(ContractionHierarchyTest, DistanceTableMaxTest) {
+  const int TABLE_SIZE = 100;
+  srand(42);
+  Graph graph = generate_grid_graph(QUERY_GRID_SIDE);
+  ContractionHierarchy hierarchy(graph);
+  vector<int> sources(TABLE_SIZE);
+  vector<int> targets(TABLE_SIZE);
+  for (int i = 0; i < TABLE_SIZE; ++i) {
+    sources[i] = rand() % graph.size();
+    targets[i] = rand() % graph.size();
+  }
+  vector<int> table;
+  hierarchy.distance_table(sources, targets, table);
+}
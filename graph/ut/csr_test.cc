@@ -0,0 +1,123 @@
+#include "graph/csr.h"
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "gtest/gtest.h"
+
+#include "graph/ssspp.h"
+#include "graph/apspp.h"
+#include "graph/maxflow.h"
+
+using std::vector;
+
+TEST(CsrGraphTest, Conversion) {
+  for (int vertices_count = 1; vertices_count < 10; ++vertices_count) {
+    for (int arcs_count = 0;
+         arcs_count < vertices_count * (vertices_count - 1);
+         ++arcs_count) {
+      Graph graph = generate_random_graph(vertices_count, arcs_count);
+      CsrGraph csr_graph(graph);
+      ASSERT_EQ(vertices_count, csr_graph.size());
+      ASSERT_EQ(arcs_count, csr_graph.arcs_count());
+
+      Graph restored_graph = csr_graph.to_graph();
+      for (int tail = 0; tail < vertices_count; ++tail) {
+        ASSERT_EQ(graph[tail].size(), restored_graph[tail].size());
+        for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+          EXPECT_EQ(graph[tail][arc_index].head,
+                    restored_graph[tail][arc_index].head);
+          EXPECT_EQ(graph[tail][arc_index].weight,
+                    restored_graph[tail][arc_index].weight);
+        }
+      }
+    }
+  }
+}
+
+TEST(CsrGraphTest, SingleSource) {
+  for (int vertices_count = 1; vertices_count < 10; ++vertices_count) {
+    for (int arcs_count = 0;
+         arcs_count < vertices_count * (vertices_count - 1);
+         ++arcs_count) {
+      Graph graph = generate_random_graph(vertices_count, arcs_count);
+      CsrGraph csr_graph(graph);
+      int source = rand() % vertices_count;
+
+      vector<int> expected;
+      dijkstra_on_kary_heap<2>(graph, source, expected);
+
+      vector<int> dijkstra_on_kary_heap_result;
+      dijkstra_on_kary_heap<4>(csr_graph, source,
+                               dijkstra_on_kary_heap_result);
+
+      vector<int> ford_bellman_on_queue_result;
+      ford_bellman_on_queue(csr_graph, source, ford_bellman_on_queue_result);
+
+      ASSERT_EQ(expected, dijkstra_on_kary_heap_result);
+      ASSERT_EQ(expected, ford_bellman_on_queue_result);
+    }
+  }
+}
+
+TEST(CsrGraphTest, Johnson) {
+  for (int vertices_count = 1; vertices_count < 10; ++vertices_count) {
+    for (int arcs_count = 0;
+         arcs_count < vertices_count * (vertices_count - 1);
+         ++arcs_count) {
+      Graph graph = generate_random_graph(vertices_count, arcs_count);
+
+      vector< vector<int> > expected;
+      floyd(graph, expected);
+
+      vector< vector<int> > shortest_paths;
+      johnson(CsrGraph(graph), shortest_paths);
+
+      ASSERT_EQ(expected, shortest_paths);
+    }
+  }
+}
+
+TEST(CsrGraphTest, BlockingFlows) {
+  const int TEST_COUNT = 100;
+  const int MAX_VERTICES_COUNT = 50;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 2;
+    int arcs_count = rand() % (vertices_count * vertices_count);
+    Graph graph = normalize(generate_random_graph(vertices_count, arcs_count),
+                            0, vertices_count - 1);
+
+    Graph flow;
+    EXPECT_EQ(blocking_flows(graph, 0, vertices_count - 1, flow),
+              blocking_flows(CsrGraph(graph), 0, vertices_count - 1, flow));
+  }
+}
+
+// Two following tests run the same queries on both representations,
+// compare their running times.
+const int BENCHMARK_VERTICES_COUNT = 20000;
+const int BENCHMARK_ARCS_COUNT = 20 * BENCHMARK_VERTICES_COUNT;
+const int BENCHMARK_SOURCES_COUNT = 10;
+
+TEST(CsrGraphTest, DijkstraOnGraphMaxTest) {
+  srand(42);
+  Graph graph = generate_random_graph(BENCHMARK_VERTICES_COUNT,
+                                      BENCHMARK_ARCS_COUNT);
+  for (int test = 0; test < BENCHMARK_SOURCES_COUNT; ++test) {
+    vector<int> distance;
+    dijkstra_on_kary_heap<4>(graph, test, distance);
+  }
+}
+
+TEST(CsrGraphTest, DijkstraOnCsrGraphMaxTest) {
+  srand(42);
+  CsrGraph graph(generate_random_graph(BENCHMARK_VERTICES_COUNT,
+                                       BENCHMARK_ARCS_COUNT));
+  for (int test = 0; test < BENCHMARK_SOURCES_COUNT; ++test) {
+    vector<int> distance;
+    dijkstra_on_kary_heap<4>(graph, test, distance);
+  }
+}
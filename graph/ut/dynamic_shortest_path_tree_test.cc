@@ -0,0 +1,158 @@
+#include "graph/dynamic_shortest_path_tree.h"
+
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/ssspp.h"
+#include "graph/ut/test_utils.h"
+
+using std::vector;
+
+void check_tree(const DynamicShortestPathTree& tree) {
+  vector<int> expected;
+  dijkstra_on_kary_heap<4>(tree.graph(), tree.source(), expected);
+  for (int vertex = 0; vertex < tree.size(); ++vertex) {
+    ASSERT_EQ(expected[vertex], tree.distance(vertex));
+    int parent = tree.parent(vertex);
+    if (vertex == tree.source() || expected[vertex] == INFINITY) {
+      ASSERT_EQ(-1, parent);
+      continue;
+    }
+    ASSERT_NE(-1, parent);
+    bool found = false;
+    const vector<Arc>& arcs = tree.graph()[parent];
+    for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+      found |= arcs[arc_index].head == vertex &&
+          tree.distance(parent) + arcs[arc_index].weight ==
+          tree.distance(vertex);
+    }
+    ASSERT_TRUE(found);
+  }
+}
+
+// random change of random arc or new arc
+void update_randomly(DynamicShortestPathTree& tree) {
+  int tail = rand() % tree.size();
+  int arcs_count = tree.graph()[tail].size();
+  int action = rand() % 4;
+  if (arcs_count == 0 || action == 0) {
+    int head = rand() % tree.size();
+    tree.add_arc(tail, head, rand() % MAX_WEIGHT);
+  } else if (action == 1) {
+    tree.remove_arc(tail, rand() % arcs_count);
+  } else {
+    int arc_index = rand() % arcs_count;
+    int weight = tree.graph()[tail][arc_index].weight;
+    // small changes keep tree arcs in tree more often
+    tree.set_weight(tail, arc_index,
+                    action == 2 ? weight / 2 : weight * 2 + 1);
+  }
+}
+
+TEST(DynamicShortestPathTreeTest, Simple) {
+  Graph graph(4);
+  graph[0].push_back(Arc(1, 1));
+  graph[1].push_back(Arc(2, 1));
+  graph[0].push_back(Arc(2, 5));
+  graph[2].push_back(Arc(3, 1));
+
+  DynamicShortestPathTree tree(graph, 0);
+  EXPECT_EQ(3, tree.distance(3));
+  EXPECT_EQ(1, tree.parent(2));
+
+  tree.set_weight(1, 0, 10);
+  EXPECT_EQ(5, tree.distance(2));
+  EXPECT_EQ(0, tree.parent(2));
+  EXPECT_EQ(6, tree.distance(3));
+  EXPECT_EQ(2, tree.affected_vertices_count());
+
+  // arc out of tree changes nothing
+  tree.set_weight(1, 0, 20);
+  EXPECT_EQ(0, tree.affected_vertices_count());
+
+  EXPECT_EQ(1, tree.add_arc(1, 3, 1));
+  EXPECT_EQ(2, tree.distance(3));
+  EXPECT_EQ(1, tree.parent(3));
+
+  tree.remove_arc(0, 0);
+  EXPECT_EQ(INFINITY, tree.distance(1));
+  EXPECT_EQ(-1, tree.parent(1));
+  EXPECT_EQ(6, tree.distance(3));
+  check_tree(tree);
+}
+
+TEST(DynamicShortestPathTreeTest, Stress) {
+  const int TEST_COUNT = 100;
+  const int MAX_VERTICES_COUNT = 50;
+  const int UPDATES_COUNT = 50;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 2;
+    int arcs_count = rand() % (3 * vertices_count);
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+    DynamicShortestPathTree tree(graph, rand() % vertices_count);
+    check_tree(tree);
+    for (int update = 0; update < UPDATES_COUNT; ++update) {
+      update_randomly(tree);
+      check_tree(tree);
+    }
+  }
+}
+
+TEST(DynamicShortestPathTreeTest, GridBatches) {
+  const int SIDE = 30;
+  const int BATCHES_COUNT = 50;
+  const int BATCH_SIZE = 20;
+  srand(42);
+
+  DynamicShortestPathTree tree(generate_grid_graph(SIDE), 0);
+  for (int batch = 0; batch < BATCHES_COUNT; ++batch) {
+    for (int update = 0; update < BATCH_SIZE; ++update) {
+      update_randomly(tree);
+    }
+    check_tree(tree);
+  }
+}
+
+// Following tests apply the same weight changes to road-like graph,
+// recomputation from scratch runs Dijkstra after each batch of them.
+const int DYNAMIC_GRID_SIDE = 300;
+const int DYNAMIC_BATCHES_COUNT = 20;
+const int DYNAMIC_BATCH_SIZE = 100;
+
+// each weight goes up or down by at most its half
+void change_random_weight(Graph& graph, int& tail, int& arc_index) {
+  tail = rand() % graph.size();
+  arc_index = rand() % graph[tail].size();
+  int& weight = graph[tail][arc_index].weight;
+  weight += rand() % (weight + 1) - weight / 2;
+}
+
+TEST(DynamicShortestPathTreeTest, RecomputeMaxTest) {
+  srand(42);
+  Graph graph = generate_grid_graph(DYNAMIC_GRID_SIDE);
+  vector<int> distance;
+  for (int batch = 0; batch < DYNAMIC_BATCHES_COUNT; ++batch) {
+    for (int update = 0; update < DYNAMIC_BATCH_SIZE; ++update) {
+      int tail, arc_index;
+      change_random_weight(graph, tail, arc_index);
+    }
+    dijkstra_on_kary_heap<4>(graph, 0, distance);
+  }
+}
+
+TEST(DynamicShortestPathTreeTest, DynamicUpdatesMaxTest) {
+  srand(42);
+  Graph graph = generate_grid_graph(DYNAMIC_GRID_SIDE);
+  DynamicShortestPathTree tree(graph, 0);
+  for (int batch = 0; batch < DYNAMIC_BATCHES_COUNT; ++batch) {
+    for (int update = 0; update < DYNAMIC_BATCH_SIZE; ++update) {
+      int tail, arc_index;
+      change_random_weight(graph, tail, arc_index);
+      tree.set_weight(tail, arc_index, graph[tail][arc_index].weight);
+    }
+  }
+}
@@ -0,0 +1,182 @@
+#include "graph/generators.h"
+
+#include <vector>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+#include "graph/ut/test_utils.h"
+
+using std::vector;
+
+// vertices, arcs and weights are in their ranges, no self-loops
+void check_graph(const Graph& graph,
+                 int vertices_count,
+                 int arcs_count) {
+  ASSERT_EQ(vertices_count, graph.size());
+  int actual_arcs_count = 0;
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    actual_arcs_count += graph[tail].size();
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      ASSERT_LE(0, arc.head);
+      ASSERT_GT(vertices_count, arc.head);
+      ASSERT_NE(tail, arc.head);
+      ASSERT_LE(0, arc.weight);
+      ASSERT_GT(MAX_WEIGHT, arc.weight);
+    }
+  }
+  ASSERT_EQ(arcs_count, actual_arcs_count);
+}
+
+int max_out_degree(const Graph& graph) {
+  int result = 0;
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    result = std::max<int>(result, graph[vertex].size());
+  }
+  return result;
+}
+
+TEST(GeneratorsTest, RandomGenerator) {
+  const int SAMPLES_COUNT = 100000;
+  const int BOUND = 10;
+  RandomGenerator random(42);
+  RandomGenerator same_random(42);
+  RandomGenerator other_stream(42, 1);
+  int equal_count = 0;
+  for (int i = 0; i < SAMPLES_COUNT; ++i) {
+    unsigned long long value = random.next();
+    ASSERT_EQ(value, same_random.next());
+    equal_count += value == other_stream.next();
+  }
+
+  vector<int> counts(BOUND, 0);
+  double sum = 0;
+  for (int i = 0; i < SAMPLES_COUNT; ++i) {
+    int bounded = random.uniform(BOUND);
+    ASSERT_LE(0, bounded);
+    ASSERT_GT(BOUND, bounded);
+    ++counts[bounded];
+
+    double real = random.uniform_real();
+    ASSERT_LE(0.0, real);
+    ASSERT_GT(1.0, real);
+    sum += real;
+  }
+  EXPECT_EQ(0, equal_count);
+  EXPECT_NEAR(0.5, sum / SAMPLES_COUNT, 0.01);
+  for (int value = 0; value < BOUND; ++value) {
+    EXPECT_NEAR(SAMPLES_COUNT / BOUND, counts[value], SAMPLES_COUNT / 100);
+  }
+}
+
+// more than one chunk of arcs, so threads share work
+const int GENERATOR_VERTICES_COUNT = 1 << 12;
+const int GENERATOR_ARCS_COUNT = 200000;
+
+TEST(GeneratorsTest, Uniform) {
+  Graph graph = generate_uniform_graph(GENERATOR_VERTICES_COUNT,
+                                       GENERATOR_ARCS_COUNT, 42, 1);
+  check_graph(graph, GENERATOR_VERTICES_COUNT, GENERATOR_ARCS_COUNT);
+  expect_equal_graphs(graph,
+                      generate_uniform_graph(GENERATOR_VERTICES_COUNT,
+                                             GENERATOR_ARCS_COUNT, 42, 3));
+  check_graph(generate_uniform_graph(2, 10, 42, 1), 2, 10);
+  EXPECT_GT(100, max_out_degree(graph));
+}
+
+TEST(GeneratorsTest, Rmat) {
+  Graph graph = generate_rmat_graph(12, GENERATOR_ARCS_COUNT, 42, 1);
+  check_graph(graph, GENERATOR_VERTICES_COUNT, GENERATOR_ARCS_COUNT);
+  expect_equal_graphs(graph,
+                      generate_rmat_graph(12, GENERATOR_ARCS_COUNT, 42, 3));
+  // hubs have thousands of arcs, average degree is about 50
+  EXPECT_LT(1000, max_out_degree(graph));
+  // hubs are shuffled away from small ids
+  EXPECT_GT(max_out_degree(graph), graph[0].size());
+}
+
+TEST(GeneratorsTest, PowerLaw) {
+  Graph graph = generate_power_law_graph(GENERATOR_VERTICES_COUNT,
+                                         GENERATOR_ARCS_COUNT, 2.5, 42, 1);
+  check_graph(graph, GENERATOR_VERTICES_COUNT, GENERATOR_ARCS_COUNT);
+  expect_equal_graphs(graph,
+                      generate_power_law_graph(GENERATOR_VERTICES_COUNT,
+                                               GENERATOR_ARCS_COUNT,
+                                               2.5, 42, 3));
+  EXPECT_LT(1000, max_out_degree(graph));
+}
+
+TEST(GeneratorsTest, Road) {
+  const int ROWS = 40;
+  const int COLUMNS = 70;
+  Graph graph = generate_road_graph(ROWS, COLUMNS, 42, 1);
+  ASSERT_EQ(ROWS * COLUMNS, graph.size());
+  expect_equal_graphs(graph, generate_road_graph(ROWS, COLUMNS, 42, 3));
+
+  int arcs_count = 0;
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    arcs_count += graph[tail].size();
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      int distance = std::abs(arc.head - tail);
+      ASSERT_TRUE(distance == 1 || distance == COLUMNS);
+      ASSERT_LE(100 / ROAD_HIGHWAY_SPEEDUP, arc.weight);
+      ASSERT_GT(1000, arc.weight);
+      // streets have the same weight in both directions
+      bool found = false;
+      for (int i = 0; i < graph[arc.head].size(); ++i) {
+        found |= graph[arc.head][i].head == tail &&
+            graph[arc.head][i].weight == arc.weight;
+      }
+      ASSERT_TRUE(found);
+      // highway along the first row
+      if (tail < COLUMNS && arc.head < COLUMNS) {
+        ASSERT_GT(1000 / ROAD_HIGHWAY_SPEEDUP, arc.weight);
+      }
+    }
+  }
+  EXPECT_EQ(2 * (ROWS * (COLUMNS - 1) + (ROWS - 1) * COLUMNS), arcs_count);
+}
+
+TEST(GeneratorsTest, LayeredDag) {
+  const int LAYERS_COUNT = 50;
+  const int LAYER_WIDTH = 100;
+  Graph graph = generate_layered_dag(LAYERS_COUNT, LAYER_WIDTH,
+                                     GENERATOR_ARCS_COUNT, 42, 1);
+  check_graph(graph, LAYERS_COUNT * LAYER_WIDTH, GENERATOR_ARCS_COUNT);
+  expect_equal_graphs(graph,
+                      generate_layered_dag(LAYERS_COUNT, LAYER_WIDTH,
+                                           GENERATOR_ARCS_COUNT, 42, 3));
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      ASSERT_EQ(tail / LAYER_WIDTH + 1,
+                graph[tail][arc_index].head / LAYER_WIDTH);
+    }
+  }
+}
+
+// Generation speed of uniform graph by rand() and by chunks of arcs
+const int UNIFORM_VERTICES_COUNT = 1000000;
+const int UNIFORM_ARCS_COUNT = 10 * UNIFORM_VERTICES_COUNT;
+
+TEST(GeneratorsTest, GenerateRandomGraphMaxTest) {
+  srand(42);
+  generate_random_graph(UNIFORM_VERTICES_COUNT, UNIFORM_ARCS_COUNT);
+}
+
+TEST(GeneratorsTest, Uniform1ThreadMaxTest) {
+  generate_uniform_graph(UNIFORM_VERTICES_COUNT, UNIFORM_ARCS_COUNT, 42, 1);
+}
+
+TEST(GeneratorsTest, Uniform4ThreadsMaxTest) {
+  generate_uniform_graph(UNIFORM_VERTICES_COUNT, UNIFORM_ARCS_COUNT, 42, 4);
+}
+
+TEST(GeneratorsTest, RmatMaxTest) {
+  generate_rmat_graph(20, UNIFORM_ARCS_COUNT, 42, 4);
+}
+
+TEST(GeneratorsTest, RoadMaxTest) {
+  generate_road_graph(1000, 1000, 42, 4);
+}
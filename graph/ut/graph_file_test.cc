@@ -0,0 +1,186 @@
+#include "graph/graph_file.h"
+
+#include <cstdio>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "graph/csr.h"
+#include "graph/ssspp.h"
+#include "graph/ut/test_utils.h"
+
+using std::vector;
+
+TEST(GraphFileTest, SaveAndMap) {
+  srand(42);
+  for (int vertices_count = 1; vertices_count < 30; ++vertices_count) {
+    int arcs_count = rand() % (vertices_count * (vertices_count - 1) + 1);
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+    save_graph(graph, "test.graph");
+
+    MappedGraph mapped_graph("test.graph");
+    ASSERT_EQ(vertices_count, mapped_graph.graph().size());
+    ASSERT_EQ(arcs_count, mapped_graph.graph().arcs_count());
+    expect_equal_graphs(graph, mapped_graph.graph().to_graph());
+
+    int source = rand() % vertices_count;
+    vector<int> expected;
+    dijkstra_on_kary_heap<2>(graph, source, expected);
+    vector<int> distances;
+    dijkstra_on_kary_heap<4>(mapped_graph.graph(), source, distances);
+    ASSERT_EQ(expected, distances);
+    ford_bellman_on_queue(mapped_graph.graph(), source, distances);
+    ASSERT_EQ(expected, distances);
+  }
+  std::remove("test.graph");
+}
+
+TEST(GraphFileTest, CopyOfView) {
+  Graph graph = generate_random_graph(10, 20);
+  save_graph(graph, "test.graph");
+  MappedGraph mapped_graph("test.graph");
+
+  CsrGraph copy = mapped_graph.graph();
+  expect_equal_graphs(graph, copy.to_graph());
+  CsrGraph owning_copy(graph);
+  copy = owning_copy;
+  owning_copy = CsrGraph();
+  expect_equal_graphs(graph, copy.to_graph());
+  std::remove("test.graph");
+}
+
+TEST(GraphFileTest, BadFiles) {
+  EXPECT_THROW(MappedGraph("missing.graph"), std::runtime_error);
+
+  std::ofstream("empty.graph");
+  EXPECT_THROW(MappedGraph("empty.graph"), std::runtime_error);
+
+  save_graph(generate_random_graph(10, 20), "test.graph");
+  {
+    std::ofstream out("truncated.graph", std::ios::binary);
+    std::ifstream in("test.graph", std::ios::binary);
+    vector<char> data(100);
+    in.read(&data[0], data.size());
+    out.write(&data[0], data.size());
+  }
+  EXPECT_THROW(MappedGraph("truncated.graph"), std::runtime_error);
+
+  {
+    std::ofstream out("text.graph");
+    out << "10 20 1 2\n1 2 3\n";
+  }
+  EXPECT_THROW(MappedGraph("text.graph"), std::runtime_error);
+
+  std::remove("empty.graph");
+  std::remove("test.graph");
+  std::remove("truncated.graph");
+  std::remove("text.graph");
+}
+
+TEST(GraphFileTest, CorruptedArrays) {
+  const int VERTICES_COUNT = 10;
+  const int ARCS_COUNT = 20;
+  // header takes four ints
+  const int OFFSETS_POSITION = 4;
+  const int HEADS_POSITION = OFFSETS_POSITION + VERTICES_COUNT + 1;
+  save_graph(generate_random_graph(VERTICES_COUNT, ARCS_COUNT), "test.graph");
+
+  write_corrupted_copy("test.graph", "corrupted.graph", 2, -1);
+  EXPECT_THROW(MappedGraph("corrupted.graph"), std::runtime_error);
+
+  write_corrupted_copy("test.graph", "corrupted.graph",
+                       OFFSETS_POSITION, 1);
+  EXPECT_THROW(MappedGraph("corrupted.graph"), std::runtime_error);
+  write_corrupted_copy("test.graph", "corrupted.graph",
+                       OFFSETS_POSITION + 5, ARCS_COUNT + 1);
+  EXPECT_THROW(MappedGraph("corrupted.graph"), std::runtime_error);
+  write_corrupted_copy("test.graph", "corrupted.graph",
+                       HEADS_POSITION - 1, ARCS_COUNT - 1);
+  EXPECT_THROW(MappedGraph("corrupted.graph"), std::runtime_error);
+
+  write_corrupted_copy("test.graph", "corrupted.graph",
+                       HEADS_POSITION + 3, VERTICES_COUNT);
+  EXPECT_NO_THROW(MappedGraph("corrupted.graph"));
+  EXPECT_THROW(MappedGraph("corrupted.graph", true), std::runtime_error);
+  write_corrupted_copy("test.graph", "corrupted.graph",
+                       HEADS_POSITION + ARCS_COUNT - 1, -1);
+  EXPECT_THROW(MappedGraph("corrupted.graph", true), std::runtime_error);
+  EXPECT_NO_THROW(MappedGraph("test.graph", true));
+
+  std::remove("test.graph");
+  std::remove("corrupted.graph");
+}
+
+const int LOAD_VERTICES_COUNT = 1000000;
+const int LOAD_ARCS_COUNT = 10000000;
+
+// files are removed at exit
+struct LoadFiles {
+  LoadFiles();
+  ~LoadFiles();
+};
+
+// same graph in both formats
+LoadFiles::LoadFiles() {
+  srand(42);
+  Graph graph = generate_random_graph(LOAD_VERTICES_COUNT, LOAD_ARCS_COUNT);
+  save_graph(graph, "load_test.graph");
+
+  std::ofstream out("load_test.txt");
+  out << LOAD_VERTICES_COUNT << ' ' << LOAD_ARCS_COUNT << " 1 2\n";
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      out << tail + 1 << ' ' << arc.head + 1 << ' ' << arc.weight << '\n';
+    }
+  }
+}
+
+LoadFiles::~LoadFiles() {
+  std::remove("load_test.graph");
+  std::remove("load_test.txt");
+}
+
+// files are written once for all load tests
+void prepare_load_files() {
+  static LoadFiles load_files;
+}
+
+TEST(GraphFileTest, PrepareLoadFilesMaxTest) {
+  prepare_load_files();
+}
+
+// both loads are followed by run over all weights,
+// so mapped pages are really read
+TEST(GraphFileTest, TextLoadMaxTest) {
+  prepare_load_files();
+  std::ifstream in("load_test.txt");
+  std::streambuf* cin_buffer = std::cin.rdbuf(in.rdbuf());
+  Graph graph;
+  int source, destination;
+  input_from_lists(graph, source, destination);
+  std::cin.rdbuf(cin_buffer);
+
+  long long weights_sum = 0;
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      weights_sum += graph[tail][arc_index].weight;
+    }
+  }
+  EXPECT_LT(0, weights_sum);
+}
+
+TEST(GraphFileTest, MappedLoadMaxTest) {
+  prepare_load_files();
+  MappedGraph mapped_graph("load_test.graph");
+  const CsrGraph& graph = mapped_graph.graph();
+
+  long long weights_sum = 0;
+  for (int arc_index = 0; arc_index < graph.arcs_count(); ++arc_index) {
+    weights_sum += graph.weight(arc_index);
+  }
+  EXPECT_LT(0, weights_sum);
+}
@@ -95,3 +95,60 @@ TEST(GraphHeapTest, GraphKaryHeapStress) {
   EXPECT_TRUE(dummy_heap.empty());
   EXPECT_TRUE(kary_heap.empty());
 }
+
+// pops keys in order and decreases keys of remaining ones,
+// never going below last popped value, as Dijkstra does
+template <class Heap>
+void monotone_heap_stress(Heap& heap, int heap_size, int max_key_value) {
+  vector<int> keys(heap_size);
+  for (int i = 0; i < keys.size(); ++i) {
+    keys[i] = i;
+  }
+
+  srand(42);
+  std::random_shuffle(keys.begin(), keys.end());
+
+  GraphVectorHeap<int> dummy_heap(heap_size);
+  for (int i = 0; i < heap_size; ++i) {
+    int value = rand() % max_key_value;
+    dummy_heap.push(keys[i], value);
+    heap.push(keys[i], value);
+    EXPECT_EQ(dummy_heap.get(keys[i]), heap.get(keys[i]));
+  }
+
+  vector<bool> popped(heap_size);
+  for (int i = 0; i < heap_size; ++i) {
+    int top_value = dummy_heap.get(dummy_heap.top());
+    EXPECT_EQ(top_value, heap.get(heap.top()));
+    popped[heap.top()] = true;
+    dummy_heap.pop();
+    heap.pop();
+
+    int key = keys[rand() % heap_size];
+    if (!popped[key]) {
+      int value = dummy_heap.get(key);
+      value = top_value + (value - top_value) / 2;
+      dummy_heap.decrease_key(key, value);
+      heap.decrease_key(key, value);
+    }
+  }
+
+  EXPECT_TRUE(dummy_heap.empty());
+  EXPECT_TRUE(heap.empty());
+}
+
+TEST(GraphHeapTest, GraphRadixHeapStress) {
+  const int HEAP_SIZE = 1000;
+  const int MAX_KEY_VALUE = 1000000;
+
+  GraphRadixHeap<int> radix_heap(HEAP_SIZE);
+  monotone_heap_stress(radix_heap, HEAP_SIZE, MAX_KEY_VALUE);
+}
+
+TEST(GraphHeapTest, GraphBucketHeapStress) {
+  const int HEAP_SIZE = 1000;
+  const int MAX_KEY_VALUE = 1000;
+
+  GraphBucketHeap<int> bucket_heap(HEAP_SIZE, MAX_KEY_VALUE);
+  monotone_heap_stress(bucket_heap, HEAP_SIZE, MAX_KEY_VALUE);
+}
@@ -1,6 +1,10 @@
 #include <vector>
+#include <map>
+#include <set>
+#include <utility>
 #include <iostream>
 
+#include "graph/generators.h"
 #include "graph/maxflow.h"
 
 #include "gtest/gtest.h"
@@ -28,6 +32,16 @@ TEST(MaxFlowTest, Simplest) {
   EXPECT_EQ(2, flow.size());
   EXPECT_EQ(1, flow[0][0].head);
   EXPECT_EQ(1, flow[0][0].weight);
+
+  EXPECT_EQ(1, push_relabel(graph, 0, 1, flow));
+  EXPECT_EQ(2, flow.size());
+  EXPECT_EQ(1, flow[0][0].head);
+  EXPECT_EQ(1, flow[0][0].weight);
+
+  EXPECT_EQ(1, dinic(graph, 0, 1, flow));
+  EXPECT_EQ(2, flow.size());
+  EXPECT_EQ(1, flow[0][0].head);
+  EXPECT_EQ(1, flow[0][0].weight);
 }
 
 TEST(MaxFlowTest, UnreachableDestination) {
@@ -36,6 +50,8 @@ TEST(MaxFlowTest, UnreachableDestination) {
   Graph flow;
   EXPECT_EQ(0, edmondson_karp(graph, 0, 1, flow));
   EXPECT_EQ(0, relabel_to_front(graph, 0, 1, flow));
+  EXPECT_EQ(0, push_relabel(graph, 0, 1, flow));
+  EXPECT_EQ(0, dinic(graph, 0, 1, flow));
 }
 
 TEST(MaxFlowTest, CormenSample) {
@@ -59,6 +75,8 @@ TEST(MaxFlowTest, CormenSample) {
   EXPECT_EQ(23, edmondson_karp(graph, 0, 5, flow));
   EXPECT_EQ(23, relabel_to_front(graph, 0, 5, flow));
   EXPECT_EQ(23, blocking_flows(graph, 0, 5, flow));
+  EXPECT_EQ(23, push_relabel(graph, 0, 5, flow));
+  EXPECT_EQ(23, dinic(graph, 0, 5, flow));
 }
 
 TEST(MaxFlowTest, EdmondsonKarpMaxTest) {
@@ -89,6 +107,34 @@ TEST(MaxFlowTest, RelabelToFrontMaxTest) {
   }
 }
 
+TEST(MaxFlowTest, PushRelabelMaxTest) {
+  const int TEST_COUNT = 10;
+  const int VERTICES_COUNT = 100;
+  const int ARCS_COUNT = 10 * VERTICES_COUNT;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    Graph graph = normalize(generate_random_graph(VERTICES_COUNT, ARCS_COUNT),
+                            0, VERTICES_COUNT - 1);
+    Graph flow;
+    push_relabel(graph, 0, VERTICES_COUNT - 1, flow);
+  }
+}
+
+TEST(MaxFlowTest, DinicMaxTest) {
+  const int TEST_COUNT = 10;
+  const int VERTICES_COUNT = 100;
+  const int ARCS_COUNT = 10 * VERTICES_COUNT;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    Graph graph = normalize(generate_random_graph(VERTICES_COUNT, ARCS_COUNT),
+                            0, VERTICES_COUNT - 1);
+    Graph flow;
+    dinic(graph, 0, VERTICES_COUNT - 1, flow);
+  }
+}
+
 TEST(MaxFlowTest, BlockingFlowsMaxTest) {
   const int TEST_COUNT = 10;
   const int VERTICES_COUNT = 100;
@@ -129,9 +175,13 @@ TEST(MaxFlowTest, Stress) {
 
     int blocking_flows_result = blocking_flows(graph, vertices_count,
                                                vertices_count + 1, flow);
+
+    int push_relabel_result = push_relabel(graph, vertices_count,
+                                           vertices_count + 1, flow);
     
     EXPECT_EQ(edmondson_karp_result, relabel_to_front_result);
     EXPECT_EQ(edmondson_karp_result, blocking_flows_result);
+    EXPECT_EQ(edmondson_karp_result, push_relabel_result);
     if (edmondson_karp_result != relabel_to_front_result) {
       cerr << "graph: " << endl;
       output(graph);
@@ -142,6 +192,252 @@ TEST(MaxFlowTest, Stress) {
   }
 }
 
+// checks capacity constraints summed over parallel arcs
+// and flow conservation in all vertices except terminals
+void check_flow(const Graph& graph,
+                int source,
+                int destination,
+                const Graph& flow) {
+  ASSERT_EQ(graph.size(), flow.size());
+  vector<long long> balance(graph.size());
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    std::map<int, long long> capacity;
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      capacity[graph[tail][arc_index].head] += graph[tail][arc_index].weight;
+    }
+    for (int arc_index = 0; arc_index < flow[tail].size(); ++arc_index) {
+      const Arc& arc = flow[tail][arc_index];
+      capacity[arc.head] -= arc.weight;
+      ASSERT_LE(0, capacity[arc.head]);
+      balance[tail] -= arc.weight;
+      balance[arc.head] += arc.weight;
+    }
+  }
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    if (vertex != source && vertex != destination) {
+      ASSERT_EQ(0, balance[vertex]);
+    }
+  }
+}
+
+TEST(MaxFlowTest, PushRelabelStress) {
+  const int TEST_COUNT = 100;
+  const int MAX_VERTICES_COUNT = 100;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 2;
+    int arcs_count = rand() % (5 * vertices_count);
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+    int source = rand() % vertices_count;
+    int destination = (source + 1 + rand() % (vertices_count - 1)) %
+        vertices_count;
+
+    Graph flow;
+    int blocking_flows_result = blocking_flows(graph, source,
+                                               destination, flow);
+    int push_relabel_result = push_relabel(graph, source, destination, flow);
+    ASSERT_EQ(blocking_flows_result, push_relabel_result);
+    check_flow(graph, source, destination, flow);
+  }
+}
+
+TEST(MaxFlowTest, DinicStress) {
+  const int TEST_COUNT = 100;
+  const int MAX_VERTICES_COUNT = 100;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 2;
+    int arcs_count = rand() % (5 * vertices_count);
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+    int source = rand() % vertices_count;
+    int destination = (source + 1 + rand() % (vertices_count - 1)) %
+        vertices_count;
+
+    Graph flow;
+    int blocking_flows_result = blocking_flows(graph, source,
+                                               destination, flow);
+    int dinic_result = dinic(graph, source, destination, flow);
+    ASSERT_EQ(blocking_flows_result, dinic_result);
+    check_flow(graph, source, destination, flow);
+  }
+}
+
+TEST(MaxFlowTest, DecomposeFlow) {
+  const int TEST_COUNT = 100;
+  const int MAX_VERTICES_COUNT = 100;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 2;
+    int arcs_count = rand() % (5 * vertices_count);
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+    int source = rand() % vertices_count;
+    int destination = (source + 1 + rand() % (vertices_count - 1)) %
+        vertices_count;
+
+    Graph flow;
+    int flow_value = push_relabel(graph, source, destination, flow);
+    vector<FlowPath> paths;
+    decompose_flow(flow, source, destination, paths);
+
+    // paths go by arcs of flow and do not exceed it
+    std::map< std::pair<int, int>, long long > remaining_flow;
+    for (int tail = 0; tail < flow.size(); ++tail) {
+      for (int arc_index = 0; arc_index < flow[tail].size(); ++arc_index) {
+        const Arc& arc = flow[tail][arc_index];
+        remaining_flow[std::make_pair(tail, arc.head)] += arc.weight;
+      }
+    }
+    int paths_value = 0;
+    for (int path = 0; path < paths.size(); ++path) {
+      const vector<int>& vertices = paths[path].vertices;
+      ASSERT_LT(0, paths[path].value);
+      ASSERT_EQ(source, vertices.front());
+      ASSERT_EQ(destination, vertices.back());
+      for (int i = 0; i + 1 < vertices.size(); ++i) {
+        long long& remaining =
+            remaining_flow[std::make_pair(vertices[i], vertices[i + 1])];
+        remaining -= paths[path].value;
+        ASSERT_LE(0, remaining);
+      }
+      paths_value += paths[path].value;
+    }
+    ASSERT_EQ(flow_value, paths_value);
+  }
+}
+
+TEST(MaxFlowTest, MaxFlowSolver) {
+  const int TEST_COUNT = 30;
+  const int UPDATES_COUNT = 30;
+  const int MAX_VERTICES_COUNT = 50;
+  const int MAX_CAPACITY = 100;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 2;
+    int arcs_count = rand() % (5 * vertices_count) + 1;
+    Graph graph(vertices_count);
+    // position of every arc id in graph
+    vector< std::pair<int, int> > arcs;
+    for (int tail = 0; tail < vertices_count; ++tail) {
+      for (int i = 0; i < arcs_count / vertices_count + rand() % 2; ++i) {
+        graph[tail].push_back(Arc(rand() % vertices_count,
+                                  rand() % MAX_CAPACITY));
+        arcs.push_back(std::make_pair(tail, graph[tail].size() - 1));
+      }
+    }
+    int source = rand() % vertices_count;
+    int destination = (source + 1 + rand() % (vertices_count - 1)) %
+        vertices_count;
+
+    MaxFlowSolver solver(graph, source, destination);
+    ASSERT_EQ(arcs.size(), solver.arcs_count());
+    Graph flow;
+    ASSERT_EQ(blocking_flows(graph, source, destination, flow),
+              solver.solve());
+
+    for (int update = 0; update < UPDATES_COUNT; ++update) {
+      if (rand() % 4 == 0 || arcs.empty()) {
+        int tail = rand() % vertices_count;
+        int head = rand() % vertices_count;
+        int capacity = rand() % MAX_CAPACITY;
+        graph[tail].push_back(Arc(head, capacity));
+        arcs.push_back(std::make_pair(tail, graph[tail].size() - 1));
+        ASSERT_EQ(arcs.size() - 1, solver.add_arc(tail, head, capacity));
+      } else {
+        int arc_id = rand() % arcs.size();
+        int capacity = rand() % MAX_CAPACITY;
+        graph[arcs[arc_id].first][arcs[arc_id].second].weight = capacity;
+        solver.set_capacity(arc_id, capacity);
+        ASSERT_EQ(capacity, solver.capacity(arc_id));
+        ASSERT_GE(capacity, solver.flow(arc_id));
+      }
+
+      int flow_value = solver.solve();
+      ASSERT_EQ(blocking_flows(graph, source, destination, flow), flow_value);
+      ASSERT_EQ(flow_value, solver.flow_value());
+      solver.get_flow(flow);
+      check_flow(graph, source, destination, flow);
+    }
+  }
+}
+
+// Following tests run on the same graph with 1M arcs,
+// Edmondson-Karp and relabel to front are too slow for it.
+const int LARGE_VERTICES_COUNT = 100000;
+const int LARGE_ARCS_COUNT = 10 * LARGE_VERTICES_COUNT;
+
+TEST(MaxFlowTest, BlockingFlowsLargeMaxTest) {
+  srand(42);
+  Graph graph = normalize(generate_random_graph(LARGE_VERTICES_COUNT,
+                                                LARGE_ARCS_COUNT),
+                          0, LARGE_VERTICES_COUNT - 1);
+  Graph flow;
+  blocking_flows(graph, 0, LARGE_VERTICES_COUNT - 1, flow);
+}
+
+TEST(MaxFlowTest, DinicLargeMaxTest) {
+  srand(42);
+  Graph graph = normalize(generate_random_graph(LARGE_VERTICES_COUNT,
+                                                LARGE_ARCS_COUNT),
+                          0, LARGE_VERTICES_COUNT - 1);
+  Graph flow;
+  dinic(graph, 0, LARGE_VERTICES_COUNT - 1, flow);
+}
+
+TEST(MaxFlowTest, PushRelabelLargeMaxTest) {
+  srand(42);
+  Graph graph = normalize(generate_random_graph(LARGE_VERTICES_COUNT,
+                                                LARGE_ARCS_COUNT),
+                          0, LARGE_VERTICES_COUNT - 1);
+  Graph flow;
+  push_relabel(graph, 0, LARGE_VERTICES_COUNT - 1, flow);
+}
+
+// Same updates of capacities on large graph: incremental solver
+// against solving from scratch after every update.
+const int CAPACITY_UPDATES_COUNT = 5;
+
+TEST(MaxFlowTest, BlockingFlowsUpdatesMaxTest) {
+  srand(42);
+  Graph graph = normalize(generate_random_graph(LARGE_VERTICES_COUNT,
+                                                LARGE_ARCS_COUNT),
+                          0, LARGE_VERTICES_COUNT - 1);
+  Graph flow;
+  blocking_flows(graph, 0, LARGE_VERTICES_COUNT - 1, flow);
+  for (int update = 0; update < CAPACITY_UPDATES_COUNT; ++update) {
+    int tail = rand() % LARGE_VERTICES_COUNT;
+    if (!graph[tail].empty()) {
+      graph[tail][rand() % graph[tail].size()].weight = rand() % MAX_WEIGHT;
+    }
+    blocking_flows(graph, 0, LARGE_VERTICES_COUNT - 1, flow);
+  }
+}
+
+TEST(MaxFlowTest, MaxFlowSolverUpdatesMaxTest) {
+  srand(42);
+  Graph graph = normalize(generate_random_graph(LARGE_VERTICES_COUNT,
+                                                LARGE_ARCS_COUNT),
+                          0, LARGE_VERTICES_COUNT - 1);
+  vector<int> first_arc_ids(LARGE_VERTICES_COUNT, 0);
+  for (int vertex = 0; vertex + 1 < LARGE_VERTICES_COUNT; ++vertex) {
+    first_arc_ids[vertex + 1] = first_arc_ids[vertex] + graph[vertex].size();
+  }
+
+  MaxFlowSolver solver(graph, 0, LARGE_VERTICES_COUNT - 1);
+  solver.solve();
+  for (int update = 0; update < CAPACITY_UPDATES_COUNT; ++update) {
+    int tail = rand() % LARGE_VERTICES_COUNT;
+    if (!graph[tail].empty()) {
+      solver.set_capacity(first_arc_ids[tail] + rand() % graph[tail].size(),
+                          rand() % MAX_WEIGHT);
+    }
+    solver.solve();
+  }
+}
+
 TEST(MaxFlowTest, SelfIncomingEdges) {
   Graph graph(3);
   graph[0].push_back(Arc(1, 1));
@@ -152,4 +448,280 @@ TEST(MaxFlowTest, SelfIncomingEdges) {
   EXPECT_EQ(1, edmondson_karp(graph, 0, 2, flow));
   EXPECT_EQ(1, relabel_to_front(graph, 0, 2, flow));
   EXPECT_EQ(1, blocking_flows(graph, 0, 2, flow));
+  EXPECT_EQ(1, push_relabel(graph, 0, 2, flow));
+  EXPECT_EQ(1, dinic(graph, 0, 2, flow));
+}
+
+vector< std::pair<int, int> > generate_random_bipartite_arcs(
+    int part_size, int arcs_count) {
+  vector< std::pair<int, int> > arcs(arcs_count);
+  for (int arc_index = 0; arc_index < arcs_count; ++arc_index) {
+    arcs[arc_index] = std::make_pair(rand() % part_size, rand() % part_size);
+  }
+  return arcs;
+}
+
+Graph to_bipartite_graph(int part_size,
+                         const vector< std::pair<int, int> >& arcs) {
+  Graph graph(part_size);
+  for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+    graph[arcs[arc_index].first].push_back(Arc(arcs[arc_index].second, 1));
+  }
+  return graph;
+}
+
+TEST(MatchingTest, HopcroftKarp) {
+  const int TEST_COUNT = 200;
+  const int MAX_PART_SIZE = 50;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int part_size = rand() % MAX_PART_SIZE + 1;
+    int arcs_count = rand() % (3 * part_size);
+    vector< std::pair<int, int> > arcs =
+        generate_random_bipartite_arcs(part_size, arcs_count);
+
+    int expected = get_max_bipartite_matching_simply(part_size, part_size,
+                                                     arcs);
+    ASSERT_EQ(expected,
+              get_max_bipartite_matching(to_bipartite_graph(part_size, arcs)));
+
+    for (int greedy = 0; greedy < 2; ++greedy) {
+      vector<int> left_part_matches;
+      ASSERT_EQ(expected, hopcroft_karp(part_size, part_size, arcs,
+                                        left_part_matches, greedy));
+
+      // matching is made of arcs and has no common vertices
+      std::set< std::pair<int, int> > arcs_set(arcs.begin(), arcs.end());
+      vector<bool> right_matched(part_size);
+      int matching_size = 0;
+      for (int left = 0; left < part_size; ++left) {
+        int right = left_part_matches[left];
+        if (right != -1) {
+          ASSERT_TRUE(arcs_set.count(std::make_pair(left, right)));
+          ASSERT_FALSE(right_matched[right]);
+          right_matched[right] = true;
+          ++matching_size;
+        }
+      }
+      ASSERT_EQ(expected, matching_size);
+    }
+  }
+}
+
+// Three following tests find matching in the same graph
+const int MATCHING_PART_SIZE = 2000;
+const int MATCHING_ARCS_COUNT = 3 * MATCHING_PART_SIZE;
+
+TEST(MatchingTest, MaxFlowMatchingMaxTest) {
+  srand(42);
+  vector< std::pair<int, int> > arcs =
+      generate_random_bipartite_arcs(MATCHING_PART_SIZE, MATCHING_ARCS_COUNT);
+  get_max_bipartite_matching(to_bipartite_graph(MATCHING_PART_SIZE, arcs));
+}
+
+TEST(MatchingTest, KuhnMatchingMaxTest) {
+  srand(42);
+  vector< std::pair<int, int> > arcs =
+      generate_random_bipartite_arcs(MATCHING_PART_SIZE, MATCHING_ARCS_COUNT);
+  get_max_bipartite_matching_simply(MATCHING_PART_SIZE, MATCHING_PART_SIZE,
+                                    arcs);
+}
+
+TEST(MatchingTest, HopcroftKarpMaxTest) {
+  srand(42);
+  vector< std::pair<int, int> > arcs =
+      generate_random_bipartite_arcs(MATCHING_PART_SIZE, MATCHING_ARCS_COUNT);
+  hopcroft_karp(MATCHING_PART_SIZE, MATCHING_PART_SIZE, arcs);
+}
+
+// assignment graph with 1M arcs
+TEST(MatchingTest, HopcroftKarpLargeMaxTest) {
+  const int PART_SIZE = 200000;
+  const int ARCS_COUNT = 1000000;
+  srand(42);
+  vector< std::pair<int, int> > arcs =
+      generate_random_bipartite_arcs(PART_SIZE, ARCS_COUNT);
+  hopcroft_karp(PART_SIZE, PART_SIZE, arcs);
+}
+
+// arcs go forward by vertex index if acyclic, so negative costs
+// make no negative cycles, there are no loops then
+CostGraph generate_random_cost_graph(int vertices_count,
+                                     int arcs_count,
+                                     int min_cost,
+                                     int max_cost,
+                                     bool acyclic) {
+  CostGraph graph(vertices_count);
+  for (int arc_index = 0; arc_index < arcs_count; ++arc_index) {
+    int tail = rand() % vertices_count;
+    int head = rand() % vertices_count;
+    while (acyclic && tail == head) {
+      head = rand() % vertices_count;
+    }
+    if (acyclic && tail > head) {
+      std::swap(tail, head);
+    }
+    graph[tail].push_back(CostArc(head, rand() % MAX_WEIGHT,
+                                  min_cost + rand() % (max_cost - min_cost)));
+  }
+  return graph;
+}
+
+Graph get_capacities(const CostGraph& graph) {
+  Graph capacities(graph.size());
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const CostArc& arc = graph[tail][arc_index];
+      capacities[tail].push_back(Arc(arc.head, arc.capacity));
+    }
+  }
+  return capacities;
+}
+
+TEST(MinCostFlowTest, Simple) {
+  CostGraph graph(4);
+  graph[0].push_back(CostArc(1, 2, 1));
+  graph[0].push_back(CostArc(2, 1, 2));
+  graph[1].push_back(CostArc(2, 1, 1));
+  graph[1].push_back(CostArc(3, 1, 3));
+  graph[2].push_back(CostArc(3, 2, 1));
+
+  Graph flow;
+  long long cost = 0;
+  EXPECT_EQ(3, successive_shortest_paths(graph, 0, 3, cost, flow));
+  EXPECT_EQ(10, cost);
+  EXPECT_EQ(3, cost_scaling(graph, 0, 3, cost, flow));
+  EXPECT_EQ(10, cost);
+}
+
+TEST(MinCostFlowTest, CheaperLongerPath) {
+  CostGraph graph(4);
+  graph[0].push_back(CostArc(3, 1, 10));
+  graph[0].push_back(CostArc(1, 1, 1));
+  graph[1].push_back(CostArc(2, 1, 1));
+  graph[2].push_back(CostArc(3, 1, 1));
+  graph[1].push_back(CostArc(3, 5, 1));
+
+  Graph flow;
+  long long cost = 0;
+  EXPECT_EQ(2, successive_shortest_paths(graph, 0, 3, cost, flow));
+  EXPECT_EQ(12, cost);
+  EXPECT_EQ(2, cost_scaling(graph, 0, 3, cost, flow));
+  EXPECT_EQ(12, cost);
+}
+
+TEST(MinCostFlowTest, Stress) {
+  const int TEST_COUNT = 200;
+  const int MAX_VERTICES_COUNT = 50;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 2;
+    int arcs_count = rand() % (5 * vertices_count);
+    bool negative_costs = test % 2 == 1;
+    CostGraph graph = generate_random_cost_graph(
+        vertices_count, arcs_count,
+        negative_costs ? -100 : 0, 100, negative_costs);
+    int source = rand() % vertices_count;
+    int destination = (source + 1 + rand() % (vertices_count - 1)) %
+        vertices_count;
+    Graph capacities = get_capacities(graph);
+
+    Graph flow;
+    int max_flow_value = dinic(capacities, source, destination, flow);
+
+    long long successive_shortest_paths_cost = 0;
+    ASSERT_EQ(max_flow_value,
+              successive_shortest_paths(graph, source, destination,
+                                        successive_shortest_paths_cost,
+                                        flow));
+    check_flow(capacities, source, destination, flow);
+
+    long long cost_scaling_cost = 0;
+    ASSERT_EQ(max_flow_value,
+              cost_scaling(graph, source, destination,
+                           cost_scaling_cost, flow));
+    check_flow(capacities, source, destination, flow);
+    ASSERT_EQ(successive_shortest_paths_cost, cost_scaling_cost);
+  }
+}
+
+// Both variants on the same graph with 100k arcs, terminals are
+// connected with many vertices to make flow go by many paths
+const int MIN_COST_FLOW_VERTICES_COUNT = 10000;
+const int MIN_COST_FLOW_ARCS_COUNT = 10 * MIN_COST_FLOW_VERTICES_COUNT;
+const int MIN_COST_FLOW_TERMINAL_DEGREE = 30;
+const int MIN_COST_FLOW_MAX_COST = 1000;
+
+CostGraph generate_min_cost_flow_max_test_graph() {
+  srand(42);
+  CostGraph graph = generate_random_cost_graph(
+      MIN_COST_FLOW_VERTICES_COUNT,
+      MIN_COST_FLOW_ARCS_COUNT - 2 * MIN_COST_FLOW_TERMINAL_DEGREE,
+      0, MIN_COST_FLOW_MAX_COST, false);
+  for (int i = 0; i < MIN_COST_FLOW_TERMINAL_DEGREE; ++i) {
+    graph[0].push_back(
+        CostArc(rand() % MIN_COST_FLOW_VERTICES_COUNT, MAX_WEIGHT, 0));
+    graph[rand() % MIN_COST_FLOW_VERTICES_COUNT].push_back(
+        CostArc(MIN_COST_FLOW_VERTICES_COUNT - 1, MAX_WEIGHT, 0));
+  }
+  return graph;
+}
+
+TEST(MinCostFlowTest, SuccessiveShortestPathsMaxTest) {
+  CostGraph graph = generate_min_cost_flow_max_test_graph();
+  Graph flow;
+  long long cost = 0;
+  successive_shortest_paths(graph, 0, MIN_COST_FLOW_VERTICES_COUNT - 1,
+                            cost, flow);
+}
+
+TEST(MinCostFlowTest, CostScalingMaxTest) {
+  CostGraph graph = generate_min_cost_flow_max_test_graph();
+  Graph flow;
+  long long cost = 0;
+  cost_scaling(graph, 0, MIN_COST_FLOW_VERTICES_COUNT - 1, cost, flow);
+}
+
+// Layered network: source feeds the first layer of DAG,
+// the last layer drains to destination, weights are capacities.
+const int LAYERED_LAYERS_COUNT = 100;
+const int LAYERED_LAYER_WIDTH = 1000;
+const int LAYERED_ARCS_COUNT =
+    5 * LAYERED_LAYERS_COUNT * LAYERED_LAYER_WIDTH;
+
+Graph generate_layered_network(int& source, int& destination) {
+  Graph graph = generate_layered_dag(LAYERED_LAYERS_COUNT,
+                                     LAYERED_LAYER_WIDTH,
+                                     LAYERED_ARCS_COUNT, 42, 1);
+  source = graph.size();
+  destination = graph.size() + 1;
+  graph.resize(graph.size() + 2);
+  for (int index = 0; index < LAYERED_LAYER_WIDTH; ++index) {
+    graph[source].push_back(Arc(index, MAX_WEIGHT));
+    graph[source - 1 - index].push_back(Arc(destination, MAX_WEIGHT));
+  }
+  return normalize(graph, source, destination);
+}
+
+TEST(MaxFlowTest, LayeredDinicMaxTest) {
+  int source, destination;
+  Graph graph = generate_layered_network(source, destination);
+  Graph flow;
+  dinic(graph, source, destination, flow);
+}
+
+TEST(MaxFlowTest, LayeredPushRelabelMaxTest) {
+  int source, destination;
+  Graph graph = generate_layered_network(source, destination);
+  Graph flow;
+  push_relabel(graph, source, destination, flow);
+}
+
+TEST(MaxFlowTest, LayeredBlockingFlowsMaxTest) {
+  int source, destination;
+  Graph graph = generate_layered_network(source, destination);
+  Graph flow;
+  blocking_flows(graph, source, destination, flow);
 }
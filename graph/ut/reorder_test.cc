@@ -0,0 +1,207 @@
+#include "graph/reorder.h"
+
+#include <cstdlib>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+#include "graph/ssspp.h"
+#include "graph/ut/test_utils.h"
+
+using std::vector;
+using std::pair;
+using std::make_pair;
+
+const VertexOrder ORDERS[] = {
+  BFS_ORDER,
+  REVERSE_CUTHILL_MCKEE_ORDER,
+  DEGREE_ORDER
+};
+const int ORDERS_COUNT = sizeof(ORDERS) / sizeof(ORDERS[0]);
+
+void random_permutation(int size, vector<int>& permutation) {
+  permutation.resize(size);
+  for (int i = 0; i < size; ++i) {
+    permutation[i] = i;
+  }
+  for (int i = size - 1; i > 0; --i) {
+    std::swap(permutation[i], permutation[rand() % (i + 1)]);
+  }
+}
+
+// grid with randomly renamed vertices and coordinates of them
+Graph generate_shuffled_grid_graph(int side,
+                                   vector< pair<int, int> >& coordinates) {
+  Graph grid = generate_grid_graph(side);
+  vector<int> old_id, new_id;
+  random_permutation(grid.size(), old_id);
+  coordinates.resize(grid.size());
+  for (int vertex = 0; vertex < grid.size(); ++vertex) {
+    coordinates[vertex] = make_pair(old_id[vertex] % side,
+                                    old_id[vertex] / side);
+  }
+  return reorder(grid, old_id, new_id);
+}
+
+// the largest difference of ids of arc ends
+int bandwidth(const Graph& graph) {
+  int result = 0;
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      result = std::max(result, std::abs(tail - graph[tail][arc_index].head));
+    }
+  }
+  return result;
+}
+
+void check_reordered_graph(const Graph& graph,
+                           const vector<int>& old_id,
+                           const vector<int>& new_id,
+                           const Graph& reordered_graph) {
+  ASSERT_EQ(graph.size(), old_id.size());
+  ASSERT_EQ(graph.size(), new_id.size());
+  ASSERT_EQ(graph.size(), reordered_graph.size());
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    ASSERT_LE(0, old_id[vertex]);
+    ASSERT_GT(graph.size(), old_id[vertex]);
+    ASSERT_EQ(vertex, new_id[old_id[vertex]]);
+  }
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    const vector<Arc>& arcs = reordered_graph[new_id[tail]];
+    ASSERT_EQ(graph[tail].size(), arcs.size());
+    for (int arc_index = 0; arc_index < arcs.size(); ++arc_index) {
+      ASSERT_EQ(new_id[graph[tail][arc_index].head], arcs[arc_index].head);
+      ASSERT_EQ(graph[tail][arc_index].weight, arcs[arc_index].weight);
+    }
+  }
+}
+
+TEST(ReorderTest, Stress) {
+  const int TEST_COUNT = 100;
+  const int MAX_VERTICES_COUNT = 100;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 2;
+    int arcs_count = rand() % (3 * vertices_count);
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+    int source = rand() % vertices_count;
+    vector<int> expected;
+    dijkstra_on_kary_heap<2>(graph, source, expected);
+
+    for (int order = 0; order < ORDERS_COUNT; ++order) {
+      vector<int> old_id, new_id;
+      Graph reordered_graph = reorder(graph, ORDERS[order], old_id, new_id);
+      check_reordered_graph(graph, old_id, new_id, reordered_graph);
+
+      vector<int> distances;
+      dijkstra_on_kary_heap<2>(reordered_graph, new_id[source], distances);
+      for (int vertex = 0; vertex < vertices_count; ++vertex) {
+        ASSERT_EQ(expected[vertex], distances[new_id[vertex]]);
+      }
+    }
+  }
+}
+
+TEST(ReorderTest, DegreeOrder) {
+  Graph graph(4);
+  graph[0].push_back(Arc(1, 1));
+  graph[2].push_back(Arc(1, 1));
+  graph[3].push_back(Arc(1, 1));
+  graph[3].push_back(Arc(2, 1));
+
+  vector<int> old_id;
+  vertex_order(graph, DEGREE_ORDER, old_id);
+  int expected_old_id[] = {1, 2, 3, 0};
+  EXPECT_EQ(vector<int>(expected_old_id, expected_old_id + 4), old_id);
+}
+
+TEST(ReorderTest, GridBandwidth) {
+  const int SIDE = 30;
+  srand(42);
+  vector< pair<int, int> > coordinates;
+  Graph graph = generate_shuffled_grid_graph(SIDE, coordinates);
+  ASSERT_LT(SIDE * SIDE / 2, bandwidth(graph));
+
+  vector<int> old_id, new_id;
+  EXPECT_GE(2 * SIDE, bandwidth(reorder(graph, BFS_ORDER, old_id, new_id)));
+  EXPECT_GE(2 * SIDE, bandwidth(reorder(graph, REVERSE_CUTHILL_MCKEE_ORDER,
+                                        old_id, new_id)));
+}
+
+TEST(ReorderTest, HilbertOrder) {
+  // grid block aligned with curve is passed cell by cell
+  const int SIDE = 16;
+  vector< pair<int, int> > coordinates;
+  for (int x = 0; x < SIDE; ++x) {
+    for (int y = 0; y < SIDE; ++y) {
+      coordinates.push_back(make_pair(x, y));
+    }
+  }
+  // far corner makes scale of grid exact
+  coordinates.push_back(make_pair(65535, 65535));
+
+  vector<int> old_id;
+  hilbert_order(coordinates, old_id);
+  ASSERT_EQ(coordinates.size(), old_id.size());
+  EXPECT_EQ(0, old_id[0]);
+  for (int i = 0; i + 1 < SIDE * SIDE; ++i) {
+    const pair<int, int>& point = coordinates[old_id[i]];
+    const pair<int, int>& next_point = coordinates[old_id[i + 1]];
+    ASSERT_EQ(1, std::abs(point.first - next_point.first) +
+                 std::abs(point.second - next_point.second));
+  }
+
+  vector<int> sorted_old_id = old_id;
+  std::sort(sorted_old_id.begin(), sorted_old_id.end());
+  for (int i = 0; i < sorted_old_id.size(); ++i) {
+    ASSERT_EQ(i, sorted_old_id[i]);
+  }
+}
+
+// Following tests run the same Dijkstras on shuffled grid before
+// and after reordering, time of reordering itself is included,
+// it takes about as long as a few Dijkstras.
+const int REORDER_GRID_SIDE = 700;
+const int REORDER_SSSP_COUNT = 10;
+
+// order -1 keeps shuffled ids, order ORDERS_COUNT is Hilbert order
+void reorder_sssp_max_test(int order) {
+  srand(42);
+  vector< pair<int, int> > coordinates;
+  Graph graph = generate_shuffled_grid_graph(REORDER_GRID_SIDE, coordinates);
+  vector<int> old_id, new_id;
+  if (order == ORDERS_COUNT) {
+    hilbert_order(coordinates, old_id);
+    graph = reorder(graph, old_id, new_id);
+  } else if (order >= 0) {
+    graph = reorder(graph, ORDERS[order], old_id, new_id);
+  }
+
+  vector<int> distances;
+  for (int i = 0; i < REORDER_SSSP_COUNT; ++i) {
+    dijkstra_on_kary_heap<4>(graph, rand() % graph.size(), distances);
+  }
+}
+
+TEST(ReorderTest, ShuffledSsspMaxTest) {
+  reorder_sssp_max_test(-1);
+}
+
+TEST(ReorderTest, BfsOrderSsspMaxTest) {
+  reorder_sssp_max_test(0);
+}
+
+TEST(ReorderTest, ReverseCuthillMckeeOrderSsspMaxTest) {
+  reorder_sssp_max_test(1);
+}
+
+TEST(ReorderTest, DegreeOrderSsspMaxTest) {
+  reorder_sssp_max_test(2);
+}
+
+TEST(ReorderTest, HilbertOrderSsspMaxTest) {
+  reorder_sssp_max_test(3);
+}
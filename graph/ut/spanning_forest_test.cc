@@ -0,0 +1,159 @@
+#include "graph/spanning_forest.h"
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+#include "graph/components.h"
+
+using std::vector;
+using std::pair;
+
+// Prim's algorithm in O(n^2) from every not yet spanned vertex
+long long prim_forest_weight(const Graph& graph) {
+  vector< vector<int> > weights(graph.size(),
+                                vector<int>(graph.size(), INFINITY));
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      const Arc& arc = graph[tail][arc_index];
+      int& weight = weights[tail][arc.head];
+      weight = std::min(weight, arc.weight);
+      weights[arc.head][tail] = weight;
+    }
+  }
+
+  long long forest_weight = 0;
+  vector<bool> spanned(graph.size(), false);
+  vector<int> distance(graph.size(), INFINITY);
+  for (int root = 0; root < graph.size(); ++root) {
+    if (spanned[root]) {
+      continue;
+    }
+    distance[root] = 0;
+    while (true) {
+      int closest = -1;
+      for (int vertex = 0; vertex < graph.size(); ++vertex) {
+        if (!spanned[vertex] && distance[vertex] != INFINITY &&
+            (closest == -1 || distance[vertex] < distance[closest])) {
+          closest = vertex;
+        }
+      }
+      if (closest == -1) {
+        break;
+      }
+      spanned[closest] = true;
+      forest_weight += distance[closest];
+      for (int vertex = 0; vertex < graph.size(); ++vertex) {
+        if (vertex != closest) {
+          distance[vertex] = std::min(distance[vertex],
+                                      weights[closest][vertex]);
+        }
+      }
+    }
+  }
+  return forest_weight;
+}
+
+// forest arcs have right weight, make no cycles
+// and connect every component
+void check_forest(const Graph& graph,
+                  const vector< pair<int, int> >& forest,
+                  long long forest_weight) {
+  vector<int> component;
+  int components_count = connected_components(graph, component);
+  ASSERT_EQ(graph.size() - components_count, forest.size());
+
+  Graph forest_graph(graph.size());
+  long long weight = 0;
+  for (int i = 0; i < forest.size(); ++i) {
+    const Arc& arc = graph[forest[i].first][forest[i].second];
+    forest_graph[forest[i].first].push_back(arc);
+    weight += arc.weight;
+  }
+  ASSERT_EQ(forest_weight, weight);
+  // n - c arcs spanning c components make no cycles
+  ASSERT_EQ(components_count,
+            connected_components(forest_graph, component));
+}
+
+TEST(SpanningForestTest, Simple) {
+  Graph graph(5);
+  graph[0].push_back(Arc(1, 4));
+  graph[1].push_back(Arc(2, 1));
+  graph[2].push_back(Arc(0, 2));
+  graph[0].push_back(Arc(2, 3));
+  graph[3].push_back(Arc(4, -5));
+
+  vector< pair<int, int> > forest;
+  EXPECT_EQ(-2, kruskal(graph, forest));
+  check_forest(graph, forest, -2);
+  EXPECT_EQ(-2, boruvka(graph, forest, 2));
+  check_forest(graph, forest, -2);
+}
+
+TEST(SpanningForestTest, Stress) {
+  const int TEST_COUNT = 100;
+  const int MAX_VERTICES_COUNT = 100;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 1;
+    int arcs_count = rand() % (3 * vertices_count);
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+    // many equal weights
+    if (test % 2 == 0) {
+      for (int tail = 0; tail < vertices_count; ++tail) {
+        for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+          graph[tail][arc_index].weight %= 3;
+        }
+      }
+    }
+    long long expected_weight = prim_forest_weight(graph);
+
+    vector< pair<int, int> > forest;
+    ASSERT_EQ(expected_weight, kruskal(graph, forest));
+    check_forest(graph, forest, expected_weight);
+    for (int threads_count = 1; threads_count <= 8; threads_count *= 2) {
+      ASSERT_EQ(expected_weight, boruvka(graph, forest, threads_count));
+      check_forest(graph, forest, expected_weight);
+    }
+  }
+}
+
+const int SPANNING_FOREST_VERTICES_COUNT = 1000000;
+const int SPANNING_FOREST_ARCS_COUNT = 5 * SPANNING_FOREST_VERTICES_COUNT;
+
+// threads count 0 runs Kruskal
+void spanning_forest_max_test(int threads_count) {
+  srand(42);
+  Graph graph = generate_random_graph(SPANNING_FOREST_VERTICES_COUNT,
+                                      SPANNING_FOREST_ARCS_COUNT);
+  vector< pair<int, int> > forest;
+  if (threads_count == 0) {
+    kruskal(graph, forest);
+  } else {
+    boruvka(graph, forest, threads_count);
+  }
+}
+
+TEST(SpanningForestTest, KruskalMaxTest) {
+  spanning_forest_max_test(0);
+}
+
+TEST(SpanningForestTest, Boruvka1ThreadMaxTest) {
+  spanning_forest_max_test(1);
+}
+
+TEST(SpanningForestTest, Boruvka2ThreadsMaxTest) {
+  spanning_forest_max_test(2);
+}
+
+TEST(SpanningForestTest, Boruvka4ThreadsMaxTest) {
+  spanning_forest_max_test(4);
+}
+
+TEST(SpanningForestTest, Boruvka8ThreadsMaxTest) {
+  spanning_forest_max_test(8);
+}
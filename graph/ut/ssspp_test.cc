@@ -6,6 +6,8 @@
 
 #include "gtest/gtest.h"
 
+#include "graph/generators.h"
+
 using std::vector;
 using std::cerr;
 using std::endl;
@@ -46,6 +48,9 @@ TEST(SSSPPTest, SingleSource) {
       vector<int> dijkstra_on_kary_heap_result;
       dijkstra_on_kary_heap<2>(graph, source, dijkstra_on_kary_heap_result);
 
+      vector<int> dijkstra_on_radix_heap_result;
+      dijkstra_on_radix_heap(graph, source, dijkstra_on_radix_heap_result);
+
       vector<int> ford_bellman_result;
       ford_bellman(graph, source, ford_bellman_result);
 
@@ -58,6 +63,7 @@ TEST(SSSPPTest, SingleSource) {
       ASSERT_EQ(dijkstra_on_array_result, dijkstra_on_priority_queue_result);
       ASSERT_EQ(dijkstra_on_array_result, dijkstra_on_set_result);
       ASSERT_EQ(dijkstra_on_array_result, dijkstra_on_kary_heap_result);
+      ASSERT_EQ(dijkstra_on_array_result, dijkstra_on_radix_heap_result);
       ASSERT_EQ(dijkstra_on_array_result, ford_bellman_result);
       ASSERT_EQ(dijkstra_on_array_result, ford_bellman_on_queue_result);
       ASSERT_EQ(dijkstra_on_array_result, tarjan_ssspp_result);
@@ -82,10 +88,344 @@ TEST(SSSPPTest, SourceDestination) {
         bidirected_dijkstra(graph, source, destination);
 
       EXPECT_EQ(dijkstra_on_array_result, bidirected_dijkstra_result);
+      EXPECT_EQ(dijkstra_on_array_result,
+                dijkstra_on_radix_heap(graph, source, destination));
+      EXPECT_EQ(dijkstra_on_array_result,
+                dijkstra_on_kary_heap<2>(graph, source, destination));
+      EXPECT_EQ(dijkstra_on_array_result,
+                dijkstra_on_set(graph, source, destination));
+      EXPECT_EQ(dijkstra_on_array_result,
+                dijkstra_on_priority_queue(graph, source, destination));
+      EXPECT_EQ(dijkstra_on_array_result,
+                dijkstra_on_kary_heap<2>(CsrGraph(graph), source,
+                                         destination));
+    }
+  }
+}
+
+int path_length(const Graph& graph, const vector<int>& path) {
+  int length = 0;
+  for (int i = 0; i + 1 < path.size(); ++i) {
+    int min_weight = INFINITY;
+    for (int arc_index = 0; arc_index < graph[path[i]].size(); ++arc_index) {
+      const Arc& arc = graph[path[i]][arc_index];
+      if (arc.head == path[i + 1]) {
+        min_weight = std::min(min_weight, arc.weight);
+      }
+    }
+    if (min_weight == INFINITY) {
+      return INFINITY;
+    }
+    length += min_weight;
+  }
+  return length;
+}
+
+TEST(SSSPPTest, Path) {
+  const int TEST_COUNT = 20;
+  const int VERTICES_COUNT = 100;
+  const int ARCS_COUNT = 2 * VERTICES_COUNT;
+  srand(42);
+
+  ShortestPathWorkspace workspace;
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+    int source = rand() % VERTICES_COUNT;
+    for (int destination = 0; destination < VERTICES_COUNT; ++destination) {
+      int shortest_path = dijkstra_on_kary_heap(graph, source, destination,
+                                                workspace);
+      vector<int> path;
+      workspace.get_path(destination, path);
+      if (shortest_path == INFINITY) {
+        ASSERT_TRUE(path.empty());
+      } else {
+        ASSERT_EQ(source, path.front());
+        ASSERT_EQ(destination, path.back());
+        ASSERT_EQ(shortest_path, path_length(graph, path));
+      }
+    }
+  }
+}
+
+// prints average count of settled vertices by point-to-point
+// Dijkstra with and without stop at destination
+TEST(SSSPPTest, EarlyTerminationMaxTest) {
+  const int VERTICES_COUNT = 100000;
+  const int ARCS_COUNT = 3 * VERTICES_COUNT;
+  const int QUERIES_COUNT = 30;
+  srand(42);
+
+  Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+  ShortestPathWorkspace workspace;
+  long long full_settled_count = 0;
+  long long early_settled_count = 0;
+  for (int query = 0; query < QUERIES_COUNT; ++query) {
+    int source = rand() % VERTICES_COUNT;
+    int destination = rand() % VERTICES_COUNT;
+
+    dijkstra_on_kary_heap(graph, source, workspace);
+    full_settled_count += workspace.touched_vertices().size();
+
+    dijkstra_on_kary_heap(graph, source, destination, workspace);
+    const vector<int>& touched = workspace.touched_vertices();
+    for (int i = 0; i < touched.size(); ++i) {
+      if (workspace.color(touched[i]) == BLACK) {
+        ++early_settled_count;
+      }
+    }
+  }
+  cerr << "settled without stop: " << full_settled_count / QUERIES_COUNT
+       << ", with stop at destination: "
+       << early_settled_count / QUERIES_COUNT << endl;
+}
+
+// one workspace is shared by all searches on graphs of different sizes
+TEST(SSSPPTest, Workspace) {
+  ShortestPathWorkspace workspace;
+  for (int vertices_count = 1; vertices_count < 10; ++vertices_count) {
+    for (int arcs_count = 0;
+         arcs_count < vertices_count * (vertices_count - 1);
+         ++arcs_count) {
+      Graph graph = generate_random_graph(vertices_count, arcs_count);
+      int source = rand() % vertices_count;
+
+      vector<int> expected;
+      dijkstra_on_array(graph, source, expected);
+
+      vector<int> result;
+      dijkstra_on_kary_heap(graph, source, workspace);
+      workspace.get_distances(result);
+      ASSERT_EQ(expected, result);
+
+      dijkstra_on_set(graph, source, workspace);
+      workspace.get_distances(result);
+      ASSERT_EQ(expected, result);
+
+      ford_bellman_on_queue(graph, source, workspace);
+      workspace.get_distances(result);
+      ASSERT_EQ(expected, result);
+
+      ASSERT_TRUE(tarjan_ssspp(graph, source, workspace));
+      for (int vertex = 0; vertex < vertices_count; ++vertex) {
+        ASSERT_EQ(expected[vertex], workspace.distance(vertex));
+      }
+
+      for (int destination = 0;
+           destination < vertices_count;
+           ++destination) {
+        ASSERT_EQ(expected[destination],
+                  dijkstra_on_kary_heap(graph, source, destination,
+                                        workspace));
+        ASSERT_EQ(expected[destination],
+                  dijkstra_on_set(graph, source, destination, workspace));
+        ASSERT_EQ(expected[destination],
+                  ford_bellman_on_queue(graph, source, destination,
+                                        workspace));
+      }
+    }
+  }
+}
+
+// Two following tests answer the same short queries on big graph,
+// first allocates buffers for each query, second reuses workspace.
+const int WORKSPACE_VERTICES_COUNT = 1000000;
+const int WORKSPACE_QUERIES_COUNT = 100;
+
+TEST(SSSPPTest, WithoutWorkspaceMaxTest) {
+  srand(42);
+  Graph graph = generate_random_graph(WORKSPACE_VERTICES_COUNT,
+                                      3 * WORKSPACE_VERTICES_COUNT);
+  for (int query = 0; query < WORKSPACE_QUERIES_COUNT; ++query) {
+    int source = rand() % WORKSPACE_VERTICES_COUNT;
+    int destination = graph[source].empty() ?
+        source : graph[source][0].head;
+    dijkstra_on_kary_heap<4>(graph, source, destination);
+  }
+}
+
+TEST(SSSPPTest, WorkspaceMaxTest) {
+  srand(42);
+  Graph graph = generate_random_graph(WORKSPACE_VERTICES_COUNT,
+                                      3 * WORKSPACE_VERTICES_COUNT);
+  ShortestPathWorkspace workspace(WORKSPACE_VERTICES_COUNT);
+  for (int query = 0; query < WORKSPACE_QUERIES_COUNT; ++query) {
+    int source = rand() % WORKSPACE_VERTICES_COUNT;
+    int destination = graph[source].empty() ?
+        source : graph[source][0].head;
+    dijkstra_on_kary_heap(graph, source, destination, workspace);
+  }
+}
+
+TEST(SSSPPTest, SmallWeights) {
+  const int TEST_COUNT = 100;
+  const int VERTICES_COUNT = 100;
+  const int ARCS_COUNT = 5 * VERTICES_COUNT;
+  const int MAX_SMALL_WEIGHT = 10;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+    for (int tail = 0; tail < graph.size(); ++tail) {
+      for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+        graph[tail][arc_index].weight %= MAX_SMALL_WEIGHT;
+      }
     }
+    int source = rand() % VERTICES_COUNT;
+
+    vector<int> dijkstra_on_kary_heap_result;
+    dijkstra_on_kary_heap<2>(graph, source, dijkstra_on_kary_heap_result);
+
+    vector<int> dijkstra_on_radix_heap_result;
+    dijkstra_on_radix_heap(graph, source, dijkstra_on_radix_heap_result);
+
+    vector<int> dijkstra_on_buckets_result;
+    dijkstra_on_buckets(graph, source, dijkstra_on_buckets_result);
+
+    ASSERT_EQ(dijkstra_on_kary_heap_result, dijkstra_on_radix_heap_result);
+    ASSERT_EQ(dijkstra_on_kary_heap_result, dijkstra_on_buckets_result);
+
+    int destination = rand() % VERTICES_COUNT;
+    ASSERT_EQ(dijkstra_on_kary_heap_result[destination],
+              dijkstra_on_buckets(graph, source, destination));
   }
 }
 
+TEST(SSSPPTest, DeltaStepping) {
+  const int DELTAS[] = {1000, 50000, MAX_WEIGHT / 10, 2 * MAX_WEIGHT};
+  for (int vertices_count = 1; vertices_count < 10; ++vertices_count) {
+    for (int arcs_count = 0;
+         arcs_count < vertices_count * (vertices_count - 1);
+         ++arcs_count) {
+      Graph graph = generate_random_graph(vertices_count, arcs_count);
+      int source = rand() % vertices_count;
+
+      vector<int> dijkstra_on_kary_heap_result;
+      dijkstra_on_kary_heap<2>(graph, source, dijkstra_on_kary_heap_result);
+
+      for (int threads_count = 1; threads_count <= 3; ++threads_count) {
+        int delta = DELTAS[rand() % (sizeof(DELTAS) / sizeof(DELTAS[0]))];
+        vector<int> delta_stepping_result;
+        delta_stepping(graph, source, delta_stepping_result,
+                       delta, threads_count);
+        ASSERT_EQ(dijkstra_on_kary_heap_result, delta_stepping_result);
+      }
+    }
+  }
+}
+
+TEST(SSSPPTest, DeltaSteppingStress) {
+  const int TEST_COUNT = 20;
+  const int VERTICES_COUNT = 1000;
+  const int ARCS_COUNT = 10 * VERTICES_COUNT;
+  const int THREADS_COUNT = 4;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+    int source = rand() % VERTICES_COUNT;
+
+    vector<int> dijkstra_on_kary_heap_result;
+    dijkstra_on_kary_heap<2>(graph, source, dijkstra_on_kary_heap_result);
+
+    vector<int> delta_stepping_result;
+    delta_stepping(graph, source, delta_stepping_result,
+                   MAX_WEIGHT / 10, THREADS_COUNT);
+    ASSERT_EQ(dijkstra_on_kary_heap_result, delta_stepping_result);
+  }
+}
+
+// delta stepping scaling over threads count
+void delta_stepping_max_test(int threads_count) {
+  const int TEST_COUNT = 5;
+  const int VERTICES_COUNT = 20000;
+  const int ARCS_COUNT = 20 * VERTICES_COUNT;
+  const int DELTA = MAX_WEIGHT / 20;
+  srand(42);
+
+  Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    vector<int> distance;
+    delta_stepping(graph, test, distance, DELTA, threads_count);
+  }
+}
+
+TEST(SSSPPTest, DeltaStepping1ThreadMaxTest) {
+  delta_stepping_max_test(1);
+}
+
+TEST(SSSPPTest, DeltaStepping2ThreadsMaxTest) {
+  delta_stepping_max_test(2);
+}
+
+TEST(SSSPPTest, DeltaStepping4ThreadsMaxTest) {
+  delta_stepping_max_test(4);
+}
+
+TEST(SSSPPTest, DeltaStepping8ThreadsMaxTest) {
+  delta_stepping_max_test(8);
+}
+
+TEST(SSSPPTest, DistanceTable) {
+  const int TEST_COUNT = 20;
+  const int VERTICES_COUNT = 200;
+  const int ARCS_COUNT = 2 * VERTICES_COUNT;
+  const int SOURCES_COUNT = 10;
+  const int TARGETS_COUNT = 15;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    Graph graph = generate_random_graph(VERTICES_COUNT, ARCS_COUNT);
+    vector<int> sources(SOURCES_COUNT);
+    for (int i = 0; i < SOURCES_COUNT; ++i) {
+      sources[i] = rand() % VERTICES_COUNT;
+    }
+    vector<int> targets(TARGETS_COUNT);
+    for (int i = 0; i < TARGETS_COUNT; ++i) {
+      targets[i] = rand() % VERTICES_COUNT;
+    }
+
+    vector<int> table;
+    distance_table(graph, sources, targets, table);
+    ASSERT_EQ(SOURCES_COUNT * TARGETS_COUNT, table.size());
+    for (int i = 0; i < SOURCES_COUNT; ++i) {
+      for (int j = 0; j < TARGETS_COUNT; ++j) {
+        ASSERT_EQ(dijkstra_on_kary_heap<2>(graph, sources[i], targets[j]),
+                  table[i * TARGETS_COUNT + j]);
+      }
+    }
+  }
+}
+
+// Two following tests compute the same table,
+// first by one Dijkstra per pair, second by batch.
+const int DISTANCE_TABLE_VERTICES_COUNT = 20000;
+const int DISTANCE_TABLE_SIDE = 10;
+
+TEST(SSSPPTest, DistanceTableByPairsMaxTest) {
+  srand(42);
+  Graph graph = generate_random_graph(DISTANCE_TABLE_VERTICES_COUNT,
+                                      3 * DISTANCE_TABLE_VERTICES_COUNT);
+  for (int i = 0; i < DISTANCE_TABLE_SIDE; ++i) {
+    for (int j = 0; j < DISTANCE_TABLE_SIDE; ++j) {
+      dijkstra_on_kary_heap<4>(graph, i, DISTANCE_TABLE_SIDE + j);
+    }
+  }
+}
+
+TEST(SSSPPTest, DistanceTableMaxTest) {
+  srand(42);
+  Graph graph = generate_random_graph(DISTANCE_TABLE_VERTICES_COUNT,
+                                      3 * DISTANCE_TABLE_VERTICES_COUNT);
+  vector<int> sources;
+  vector<int> targets;
+  for (int i = 0; i < DISTANCE_TABLE_SIDE; ++i) {
+    sources.push_back(i);
+    targets.push_back(DISTANCE_TABLE_SIDE + i);
+  }
+  vector<int> table;
+  distance_table(graph, sources, targets, table);
+}
+
 // test shows graph on which dijkstra breaks,
 // but ford-bellman survives
 TEST(SSSPPTest, NegativeArcs) {
@@ -123,4 +463,257 @@ TEST(SSSPPTest, NegativeCycle) {
 
   vector<int> d;
   EXPECT_FALSE(tarjan_ssspp(graph, 0, d));
+  EXPECT_FALSE(parallel_ford_bellman(graph, 0, d, 2));
+
+  // workspace stays usable after failed search
+  ShortestPathWorkspace workspace;
+  EXPECT_FALSE(tarjan_ssspp(graph, 0, workspace));
+  graph[2][0].weight = 1;
+  EXPECT_TRUE(tarjan_ssspp(graph, 0, workspace));
+  EXPECT_EQ(0, workspace.distance(2));
+}
+
+TEST(SSSPPTest, TarjanOnLongPaths) {
+  // recursive subtree disassembly would run out of stack here
+  const int PATH_LENGTH = 1000000;
+  Graph graph(2 * PATH_LENGTH + 1);
+  // deep subtree of path 1..PATH_LENGTH grows first
+  graph[0].push_back(Arc(1, 10 * PATH_LENGTH));
+  for (int vertex = 1; vertex < PATH_LENGTH; ++vertex) {
+    graph[vertex].push_back(Arc(vertex + 1, 1));
+  }
+  // then it is dropped, when path through other vertices comes to 1
+  graph[0].push_back(Arc(PATH_LENGTH + 1, 1));
+  for (int vertex = PATH_LENGTH + 1; vertex < 2 * PATH_LENGTH; ++vertex) {
+    graph[vertex].push_back(Arc(vertex + 1, 1));
+  }
+  graph[2 * PATH_LENGTH].push_back(Arc(1, 1));
+
+  ShortestPathWorkspace workspace;
+  EXPECT_TRUE(tarjan_ssspp(graph, 0, workspace));
+  EXPECT_EQ(PATH_LENGTH + 1, workspace.distance(1));
+  EXPECT_EQ(2 * PATH_LENGTH, workspace.distance(PATH_LENGTH));
+
+  // cycle through the whole first path
+  graph[PATH_LENGTH].push_back(Arc(1, -PATH_LENGTH));
+  EXPECT_FALSE(tarjan_ssspp(graph, 0, workspace));
+}
+
+// Mostly acyclic graph: arcs go a bit forward by index except for
+// share of short backward ones, which make small cycles. Weights are
+// non-negative ones shifted by potentials, so negative arcs make
+// no negative cycles.
+const int FORWARD_ARC_MAX_LENGTH = 100;
+const int BACKWARD_ARC_MAX_LENGTH = 10;
+
+Graph generate_mostly_acyclic_graph(int vertices_count,
+                                    int arcs_count,
+                                    int backward_arcs_percent) {
+  vector<int> potential(vertices_count);
+  for (int vertex = 0; vertex < vertices_count; ++vertex) {
+    potential[vertex] = rand() % MAX_WEIGHT;
+  }
+  Graph graph(vertices_count);
+  for (int arc_index = 0; arc_index < arcs_count; ++arc_index) {
+    int tail = rand() % vertices_count;
+    int head = std::min(vertices_count - 1,
+                        tail + 1 + rand() % FORWARD_ARC_MAX_LENGTH);
+    if (rand() % 100 < backward_arcs_percent) {
+      head = std::max(0, tail - 1 - rand() % BACKWARD_ARC_MAX_LENGTH);
+    }
+    graph[tail].push_back(
+        Arc(head, rand() % MAX_WEIGHT + potential[tail] - potential[head]));
+  }
+  return graph;
+}
+
+TEST(SSSPPTest, SccSsspp) {
+  const int TEST_COUNT = 200;
+  const int MAX_VERTICES_COUNT = 100;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 1;
+    int arcs_count = rand() % (3 * vertices_count);
+    Graph graph = generate_mostly_acyclic_graph(vertices_count, arcs_count,
+                                                test % 50);
+    // odd tests have no potentials, so negative cycles are possible
+    if (test % 2 == 1) {
+      for (int tail = 0; tail < vertices_count; ++tail) {
+        for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+          graph[tail][arc_index].weight =
+              rand() % (2 * MAX_WEIGHT) - MAX_WEIGHT / 4;
+        }
+      }
+    }
+    int source = rand() % vertices_count;
+
+    vector<int> tarjan_ssspp_result;
+    bool tarjan_ssspp_succeeded =
+        tarjan_ssspp(graph, source, tarjan_ssspp_result);
+    vector<int> scc_ssspp_result;
+    ASSERT_EQ(tarjan_ssspp_succeeded,
+              scc_ssspp(graph, source, scc_ssspp_result));
+    if (tarjan_ssspp_succeeded) {
+      ASSERT_EQ(tarjan_ssspp_result, scc_ssspp_result);
+    }
+  }
+}
+
+// 2% of arcs go backward, negative arcs are everywhere
+const int MOSTLY_ACYCLIC_VERTICES_COUNT = 100000;
+const int MOSTLY_ACYCLIC_ARCS_COUNT = 10 * MOSTLY_ACYCLIC_VERTICES_COUNT;
+const int MOSTLY_ACYCLIC_BACKWARD_ARCS_PERCENT = 2;
+
+TEST(SSSPPTest, MostlyAcyclicFordBellmanOnQueueMaxTest) {
+  srand(42);
+  Graph graph = generate_mostly_acyclic_graph(
+      MOSTLY_ACYCLIC_VERTICES_COUNT, MOSTLY_ACYCLIC_ARCS_COUNT,
+      MOSTLY_ACYCLIC_BACKWARD_ARCS_PERCENT);
+  vector<int> distance;
+  ford_bellman_on_queue(graph, 0, distance);
+}
+
+TEST(SSSPPTest, MostlyAcyclicTarjanMaxTest) {
+  srand(42);
+  Graph graph = generate_mostly_acyclic_graph(
+      MOSTLY_ACYCLIC_VERTICES_COUNT, MOSTLY_ACYCLIC_ARCS_COUNT,
+      MOSTLY_ACYCLIC_BACKWARD_ARCS_PERCENT);
+  vector<int> distance;
+  tarjan_ssspp(graph, 0, distance);
+}
+
+TEST(SSSPPTest, MostlyAcyclicSccSssppMaxTest) {
+  srand(42);
+  Graph graph = generate_mostly_acyclic_graph(
+      MOSTLY_ACYCLIC_VERTICES_COUNT, MOSTLY_ACYCLIC_ARCS_COUNT,
+      MOSTLY_ACYCLIC_BACKWARD_ARCS_PERCENT);
+  vector<int> distance;
+  scc_ssspp(graph, 0, distance);
+}
+
+TEST(SSSPPTest, ParallelFordBellman) {
+  const int TEST_COUNT = 200;
+  const int MAX_VERTICES_COUNT = 100;
+  srand(42);
+
+  for (int test = 0; test < TEST_COUNT; ++test) {
+    int vertices_count = rand() % MAX_VERTICES_COUNT + 2;
+    int arcs_count = rand() % (3 * vertices_count);
+    Graph graph = generate_random_graph(vertices_count, arcs_count);
+    // some of negative arcs make negative cycles
+    for (int tail = 0; tail < vertices_count; ++tail) {
+      for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+        graph[tail][arc_index].weight =
+            rand() % (2 * MAX_WEIGHT) - MAX_WEIGHT / (test % 8 + 1);
+      }
+    }
+    int source = rand() % vertices_count;
+
+    vector<int> tarjan_ssspp_result;
+    bool tarjan_ssspp_succeeded =
+        tarjan_ssspp(graph, source, tarjan_ssspp_result);
+    for (int threads_count = 1; threads_count <= 4; ++threads_count) {
+      vector<int> parallel_ford_bellman_result;
+      ASSERT_EQ(tarjan_ssspp_succeeded,
+                parallel_ford_bellman(graph, source,
+                                      parallel_ford_bellman_result,
+                                      threads_count));
+      if (tarjan_ssspp_succeeded) {
+        ASSERT_EQ(tarjan_ssspp_result, parallel_ford_bellman_result);
+      }
+    }
+  }
+}
+
+// Random graph with weights shifted by random potentials, so
+// about half of arcs are negative, but there are no negative cycles.
+// Following tests compare routines for negative weights on it,
+// plain Bellman-Ford always makes V passes, so it gets smaller graph.
+const int NEGATIVE_WEIGHTS_VERTICES_COUNT = 200000;
+const int NEGATIVE_WEIGHTS_SMALL_VERTICES_COUNT = 5000;
+
+Graph generate_negative_weights_graph(int vertices_count) {
+  srand(42);
+  Graph graph = generate_random_graph(vertices_count, 10 * vertices_count);
+  vector<int> potential(graph.size());
+  for (int vertex = 0; vertex < graph.size(); ++vertex) {
+    potential[vertex] = rand() % MAX_WEIGHT;
+  }
+  for (int tail = 0; tail < graph.size(); ++tail) {
+    for (int arc_index = 0; arc_index < graph[tail].size(); ++arc_index) {
+      Arc& arc = graph[tail][arc_index];
+      arc.weight += potential[tail] - potential[arc.head];
+    }
+  }
+  return graph;
+}
+
+TEST(SSSPPTest, NegativeWeightsFordBellmanMaxTest) {
+  Graph graph = generate_negative_weights_graph(
+      NEGATIVE_WEIGHTS_SMALL_VERTICES_COUNT);
+  vector<int> distance;
+  ford_bellman(graph, 0, distance);
+}
+
+TEST(SSSPPTest, NegativeWeightsFordBellmanOnQueueMaxTest) {
+  Graph graph = generate_negative_weights_graph(
+      NEGATIVE_WEIGHTS_VERTICES_COUNT);
+  vector<int> distance;
+  ford_bellman_on_queue(graph, 0, distance);
+}
+
+TEST(SSSPPTest, NegativeWeightsTarjanMaxTest) {
+  Graph graph = generate_negative_weights_graph(
+      NEGATIVE_WEIGHTS_VERTICES_COUNT);
+  vector<int> distance;
+  tarjan_ssspp(graph, 0, distance);
+}
+
+void negative_weights_parallel_ford_bellman_max_test(int threads_count) {
+  Graph graph = generate_negative_weights_graph(
+      NEGATIVE_WEIGHTS_VERTICES_COUNT);
+  vector<int> distance;
+  parallel_ford_bellman(graph, 0, distance, threads_count);
+}
+
+TEST(SSSPPTest, NegativeWeightsParallelFordBellman1ThreadMaxTest) {
+  negative_weights_parallel_ford_bellman_max_test(1);
+}
+
+TEST(SSSPPTest, NegativeWeightsParallelFordBellman2ThreadsMaxTest) {
+  negative_weights_parallel_ford_bellman_max_test(2);
+}
+
+TEST(SSSPPTest, NegativeWeightsParallelFordBellman4ThreadsMaxTest) {
+  negative_weights_parallel_ford_bellman_max_test(4);
+}
+
+// Dijkstra and delta stepping on inputs shaped like production ones
+const int ROAD_SIDE = 1000;
+const int RMAT_SCALE = 18;
+const int RMAT_ARCS_COUNT = 16 << RMAT_SCALE;
+
+TEST(SSSPPTest, RoadDijkstraMaxTest) {
+  Graph graph = generate_road_graph(ROAD_SIDE, ROAD_SIDE, 42, 1);
+  vector<int> distance;
+  dijkstra_on_kary_heap<4>(graph, 0, distance);
+}
+
+TEST(SSSPPTest, RoadDeltaSteppingMaxTest) {
+  Graph graph = generate_road_graph(ROAD_SIDE, ROAD_SIDE, 42, 1);
+  vector<int> distance;
+  delta_stepping(graph, 0, distance, 1000, 4);
+}
+
+TEST(SSSPPTest, RmatDijkstraMaxTest) {
+  Graph graph = generate_rmat_graph(RMAT_SCALE, RMAT_ARCS_COUNT, 42, 1);
+  vector<int> distance;
+  dijkstra_on_kary_heap<4>(graph, 0, distance);
+}
+
+TEST(SSSPPTest, RmatDeltaSteppingMaxTest) {
+  Graph graph = generate_rmat_graph(RMAT_SCALE, RMAT_ARCS_COUNT, 42, 1);
+  vector<int> distance;
+  delta_stepping(graph, 0, distance, MAX_WEIGHT / 20, 4);
 }
@@ -0,0 +1,55 @@
+#include "graph/ut/test_utils.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <fstream>
+#include <iterator>
+
+#include "gtest/gtest.h"
+
+#include "graph/common.h"
+
+using std::vector;
+
+Graph generate_grid_graph(int side) {
+  Graph graph(side * side);
+  for (int row = 0; row < side; ++row) {
+    for (int column = 0; column < side; ++column) {
+      int vertex = row * side + column;
+      if (row + 1 < side) {
+        graph[vertex].push_back(Arc(vertex + side, rand() % 1000 + 1));
+        graph[vertex + side].push_back(Arc(vertex, rand() % 1000 + 1));
+      }
+      if (column + 1 < side) {
+        graph[vertex].push_back(Arc(vertex + 1, rand() % 1000 + 1));
+        graph[vertex + 1].push_back(Arc(vertex, rand() % 1000 + 1));
+      }
+    }
+  }
+  return graph;
+}
+
+void expect_equal_graphs(const Graph& expected, const Graph& graph) {
+  ASSERT_EQ(expected.size(), graph.size());
+  for (int tail = 0; tail < expected.size(); ++tail) {
+    ASSERT_EQ(expected[tail].size(), graph[tail].size());
+    for (int arc_index = 0; arc_index < expected[tail].size(); ++arc_index) {
+      EXPECT_EQ(expected[tail][arc_index].head, graph[tail][arc_index].head);
+      EXPECT_EQ(expected[tail][arc_index].weight,
+                graph[tail][arc_index].weight);
+    }
+  }
+}
+
+void write_corrupted_copy(const char* filename,
+                          const char* corrupted_filename,
+                          int position,
+                          int value) {
+  std::ifstream in(filename, std::ios::binary);
+  vector<char> data((std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+  std::memcpy(&data[position * sizeof(value)], &value, sizeof(value));
+  std::ofstream out(corrupted_filename, std::ios::binary);
+  out.write(&data[0], data.size());
+}
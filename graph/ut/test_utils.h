@@ -0,0 +1,24 @@
+/*
+ * Helpers shared by graph tests.
+ */
+
+#ifndef _TOOLBOX_GRAPH_UT_TEST_UTILS_H_
+#define _TOOLBOX_GRAPH_UT_TEST_UTILS_H_
+
+#include "graph/common.h"
+
+// road-like graph: square grid with arcs in both directions
+// and random weights in [1, 1000], uses rand()
+Graph generate_grid_graph(int side);
+
+// same vertices and same arcs in same order
+void expect_equal_graphs(const Graph& expected, const Graph& graph);
+
+// copy of binary file with int value written at position
+// of int array the file is read as
+void write_corrupted_copy(const char* filename,
+                          const char* corrupted_filename,
+                          int position,
+                          int value);
+
+#endif  // _TOOLBOX_GRAPH_UT_TEST_UTILS_H_
@@ -2,6 +2,7 @@
 #define _TOOLBOX_BASIC_DSU_H_
 
 #include <vector>
+#include <utility>
 
 class DisjointSetUnion {
  public:
@@ -21,5 +22,47 @@ class DisjointSetUnion {
   int components_count_;
 };
 
+// Union by size with path halving in single array: root keeps
+// negated size of its set, other elements keep their parents.
+// Takes half of memory of DisjointSetUnion.
+class CompactDisjointSetUnion {
+ public:
+  explicit CompactDisjointSetUnion(int elements_count);
+
+  int get_root(int key);
+  // returns true if keys were in different sets
+  bool unite(int first_key, int second_key);
+  // unites keys of all pairs, elements of pairs ahead are
+  // prefetched while current pair is united
+  void unite_many(const std::vector< std::pair<int, int> >& pairs);
+  int get_set_size(int key)
+    { return -parents_[get_root(key)]; }
+  int get_components_count() const
+    { return components_count_; }
+ private:
+  std::vector<int> parents_;
+  int components_count_;
+};
+
+// Lock-free union-find for many threads uniting at once. Root is
+// linked under root with bigger index by compare-and-swap of its
+// parent, so parents only grow and trees stay acyclic without ranks.
+// get_root does path halving by compare-and-swap too.
+class ConcurrentDisjointSetUnion {
+ public:
+  explicit ConcurrentDisjointSetUnion(int elements_count);
+
+  int get_root(int key);
+  // returns true if keys were in different sets
+  bool unite(int first_key, int second_key);
+  // exact when no unite runs
+  int get_components_count() const
+    { return components_count_; }
+ private:
+  // parent of root is root itself
+  std::vector<int> parents_;
+  int components_count_;
+};
+
 
 #endif  // _TOOLBOX_BASIC_DSU_H_
@@ -0,0 +1,80 @@
+/*
+ * AltIndex answers point-to-point shortest path queries with
+ * A* search, which uses lower bounds on distances derived from
+ * precomputed distances to and from a few landmark vertices
+ * by triangle inequality (ALT: A*, Landmarks, Triangle inequality).
+ * Arc weights must be non-negative.
+ * Basic interface:
+ *   - build from graph, landmarks count and selection strategy
+ *   - query(source, destination), unidirectional A*
+ *   - bidirectional_query(source, destination)
+ *   - settled_vertices_count() of the last query
+ */
+
+#ifndef _TOOLBOX_GRAPH_ALT_H_
+#define _TOOLBOX_GRAPH_ALT_H_
+
+#include <vector>
+
+#include "graph/common.h"
+#include "graph/heap.h"
+
+enum LandmarkSelection {
+  RANDOM_LANDMARKS = 0,
+  // each next landmark is the farthest one from already selected
+  FARTHEST_LANDMARKS,
+  // each next landmark is a leaf of the shortest path tree from
+  // random root, whose subtree has the worst lower bounds
+  AVOID_LANDMARKS
+};
+
+class AltIndex {
+ public:
+  AltIndex(const Graph& graph,
+           int landmarks_count,
+           LandmarkSelection selection);
+
+  int size() const { return graph_.size(); }
+  const std::vector<int>& landmarks() const { return landmarks_; }
+
+  // lower bound of distance from tail to head,
+  // INFINITY if head is unreachable from tail
+  int lower_bound(int tail, int head) const;
+
+  int query(int source, int destination);
+  int bidirectional_query(int source, int destination);
+
+  int settled_vertices_count() const { return settled_vertices_count_; }
+ private:
+  void select_random_landmarks(int landmarks_count);
+  void select_farthest_landmarks(int landmarks_count);
+  void select_avoid_landmarks(int landmarks_count);
+  void add_landmark(int landmark);
+  void reset_query_buffers();
+
+  // distance between vertex and i-th landmark
+  int distance_from_landmark(int landmark_index, int vertex) const {
+    return distance_from_landmarks_[vertex * landmarks_.size() +
+                                    landmark_index];
+  }
+  int distance_to_landmark(int landmark_index, int vertex) const {
+    return distance_to_landmarks_[vertex * landmarks_.size() +
+                                  landmark_index];
+  }
+
+  Graph graph_;
+  Graph inverted_graph_;
+
+  std::vector<int> landmarks_;
+  // vertex-major tables: all landmarks of a vertex are adjacent
+  std::vector<int> distance_from_landmarks_;
+  std::vector<int> distance_to_landmarks_;
+
+  // query buffers, kept between queries
+  std::vector< std::vector<int> > distance_;
+  std::vector<int> touched_vertices_;
+  std::vector< GraphKaryHeap<long long, 4> > heaps_;
+  int settled_vertices_count_;
+};
+
+#endif  // _TOOLBOX_GRAPH_ALT_H_
@@ -3,11 +3,26 @@
 
 #include <vector>
 #include "graph/common.h"
+#include "graph/csr.h"
 
 // shortest paths between all pairs of vertices
 void floyd(const Graph& graph,
            std::vector< std::vector<int> >& shortest_paths);
-void johnson(const Graph& graph,
+// cache tiled floyd over contiguous matrix, tiles
+// are updated in parallel, min-plus kernel uses AVX2 if available
+void blocked_floyd(const Graph& graph,
+                   std::vector< std::vector<int> >& shortest_paths,
+                   int threads_count);
+// negative arcs allowed, returns false and leaves
+// shortest_paths empty if negative cycle exists
+bool johnson(const Graph& graph,
+             std::vector< std::vector<int> >& shortest_paths);
+// sources are processed in parallel, each thread reuses
+// its own heap and buffers for all of its sources
+bool parallel_johnson(const Graph& graph,
+                      std::vector< std::vector<int> >& shortest_paths,
+                      int threads_count);
+bool johnson(const CsrGraph& graph,
              std::vector< std::vector<int> >& shortest_paths);
 
 #endif  // _TOOLBOX_GRAPH_APSPP_H_
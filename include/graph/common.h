@@ -32,7 +32,8 @@ const int MAX_WEIGHT = 1000000;
 void input_from_matrix(Graph& graph, int& source, int& destination);
 void input_from_lists(Graph& graph, int& source, int& destination);
 
-// generates graph with multi arcs and 1-cycles
+// generates graph with multi arcs and 1-cycles, uses rand();
+// graph/generators.h has seeded parallel generators for big graphs
 Graph generate_random_graph(long long vertices_count, long long arcs_count);
 
 // sums up multi arcs and removes 1-cycles
@@ -0,0 +1,32 @@
+#ifndef _TOOLBOX_GRAPH_COMPONENTS_H_
+#define _TOOLBOX_GRAPH_COMPONENTS_H_
+
+#include <vector>
+#include "graph/common.h"
+
+// Connected components of graph with arcs taken as undirected edges.
+// component[v] is in [0, components count), components are numbered
+// in order of their smallest vertices. Returns components count.
+int connected_components(const Graph& graph, std::vector<int>& component);
+// arcs are streamed by threads into lock-free union-find
+int connected_components(const Graph& graph,
+                         std::vector<int>& component,
+                         int threads_count);
+
+// Strongly connected components by iterative Tarjan's algorithm,
+// components are numbered in topological order: every arc goes from
+// component to the same or greater one. Returns components count.
+int strongly_connected_components(const Graph& graph,
+                                  std::vector<int>& component);
+// vertices of component c are vertices[offsets[c] .. offsets[c + 1])
+void group_by_components(const std::vector<int>& component,
+                         int components_count,
+                         std::vector<int>& offsets,
+                         std::vector<int>& vertices);
+// DAG of components, arc between two components has the least
+// weight of arcs between their vertices
+Graph condensation(const Graph& graph,
+                   const std::vector<int>& component,
+                   int components_count);
+
+#endif  // _TOOLBOX_GRAPH_COMPONENTS_H_
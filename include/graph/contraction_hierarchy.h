@@ -0,0 +1,73 @@
+/*
+ * ContractionHierarchy answers point-to-point shortest path
+ * queries on static graph with non-negative arc weights.
+ * Preprocessing contracts vertices one by one in order of
+ * their importance, adding shortcut arcs which keep distances
+ * between remaining vertices. Query runs two Dijkstras from
+ * source and destination, both going only to higher vertices.
+ * Basic interface:
+ *   - build from graph
+ *   - query(source, destination)
+ *   - distance_table(sources, targets), many-to-many distances
+ *   - save(filename), load(filename)
+ */
+
+#ifndef _TOOLBOX_GRAPH_CONTRACTION_HIERARCHY_H_
+#define _TOOLBOX_GRAPH_CONTRACTION_HIERARCHY_H_
+
+#include <string>
+#include <vector>
+
+#include "graph/common.h"
+#include "graph/heap.h"
+
+class ContractionHierarchy {
+ public:
+  ContractionHierarchy();
+  explicit ContractionHierarchy(const Graph& graph);
+
+  int size() const { return rank_.size(); }
+
+  // position of vertex in contraction order
+  int rank(int vertex) const { return rank_[vertex]; }
+
+  // arcs to higher ranked vertices, including shortcuts
+  const Graph& upward_graph() const { return upward_graph_; }
+
+  // inverted arcs from higher ranked vertices, including shortcuts
+  const Graph& downward_graph() const { return downward_graph_; }
+
+  int query(int source, int destination);
+
+  // distances from each of sources to each of targets, table is
+  // flat row-major matrix: table[i * targets.size() + j];
+  // backward searches from targets store distances in buckets of
+  // vertices, then forward searches from sources scan these buckets
+  void distance_table(const std::vector<int>& sources,
+                      const std::vector<int>& targets,
+                      std::vector<int>& table);
+
+  void save(const std::string& filename) const;
+  // throws std::runtime_error and keeps hierarchy if file is broken
+  void load(const std::string& filename);
+ private:
+  void contract(const Graph& graph);
+  void reset_query_buffers();
+  // full search from root in upward or downward graph,
+  // reached vertices are left in touched_vertices_
+  // with their distances in forward_distance_
+  void upward_search(const Graph& graph, int root);
+
+  std::vector<int> rank_;
+  Graph upward_graph_;
+  Graph downward_graph_;
+
+  // query buffers, kept between queries
+  std::vector<int> forward_distance_;
+  std::vector<int> backward_distance_;
+  std::vector<int> touched_vertices_;
+  GraphKaryHeap<int, 4> forward_heap_;
+  GraphKaryHeap<int, 4> backward_heap_;
+};
+
+#endif  // _TOOLBOX_GRAPH_CONTRACTION_HIERARCHY_H_
@@ -0,0 +1,53 @@
+#ifndef _TOOLBOX_GRAPH_CSR_H_
+#define _TOOLBOX_GRAPH_CSR_H_
+
+#include <vector>
+#include "graph/common.h"
+
+// Compressed sparse row graph: arcs of all vertices are packed
+// into two parallel arrays, arcs of vertex v occupy indexes
+// [arcs_begin(v), arcs_end(v)). Arcs keep their order from Graph.
+// Graph either owns its arrays or is a read-only view of arrays
+// owned by someone else, e.g. of mapped graph file.
+class CsrGraph {
+ public:
+  CsrGraph();
+  explicit CsrGraph(const Graph& graph);
+  // offsets has size() + 1 elements, offsets.back() == heads.size()
+  CsrGraph(const std::vector<int>& offsets,
+           const std::vector<int>& heads,
+           const std::vector<int>& weights);
+  // view of arrays, they must outlive the graph and all its copies
+  CsrGraph(int vertices_count,
+           const int* offsets,
+           const int* heads,
+           const int* weights);
+  CsrGraph(const CsrGraph& other);
+  CsrGraph& operator=(const CsrGraph& other);
+
+  int size() const { return size_; }
+  int arcs_count() const { return offsets_[size_]; }
+
+  int arcs_begin(int vertex) const { return offsets_[vertex]; }
+  int arcs_end(int vertex) const { return offsets_[vertex + 1]; }
+
+  int head(int arc_index) const { return heads_[arc_index]; }
+  int weight(int arc_index) const { return weights_[arc_index]; }
+
+  Graph to_graph() const;
+ private:
+  void point_to_storage();
+
+  int size_;
+  bool owns_arrays_;
+  const int* offsets_;
+  const int* heads_;
+  const int* weights_;
+
+  // arrays of owning graph, empty for views
+  std::vector<int> offsets_storage_;
+  std::vector<int> heads_storage_;
+  std::vector<int> weights_storage_;
+};
+
+#endif  // _TOOLBOX_GRAPH_CSR_H_
@@ -6,16 +6,23 @@
 
 #include "graph/heap.h"
 
-template <int K>
-void dijkstra_on_kary_heap(const Graph& graph, int source,
-                           std::vector<int>& distance) {
-  std::vector<int> color(graph.size(), WHITE);
+// Heap is any of graph heaps: GraphKaryHeap, GraphRadixHeap, ...
+// Heap must be empty, color and distance are reused buffers,
+// so repeated calls do not allocate memory.
+// Search stops as soon as destination is settled, then only
+// distance of destination is final; -1 settles all vertices.
+template <class Heap>
+void dijkstra_on_graph_heap(const Graph& graph, int source,
+                            std::vector<int>& distance,
+                            std::vector<int>& color,
+                            Heap& active_vertices,
+                            int destination = -1) {
+  color.assign(graph.size(), WHITE);
   color[source] = GRAY;
 
   distance.assign(graph.size(), INFINITY);
   distance[source] = 0;
 
-  GraphKaryHeap<int, K> active_vertices(graph.size());
   active_vertices.push(source, distance[source]);
 
   while (!active_vertices.empty()) {
@@ -31,6 +38,9 @@ void dijkstra_on_kary_heap(const Graph& graph, int source,
 
     // relax
     color[closest_active_vertex] = BLACK;
+    if (closest_active_vertex == destination) {
+      break;
+    }
     for (int arc_index = 0;
          arc_index < graph[closest_active_vertex].size();
          ++arc_index) {
@@ -49,10 +59,92 @@ void dijkstra_on_kary_heap(const Graph& graph, int source,
   }
 }
 
+template <class Heap>
+void dijkstra_on_graph_heap(const Graph& graph, int source,
+                            std::vector<int>& distance,
+                            Heap& active_vertices) {
+  std::vector<int> color;
+  dijkstra_on_graph_heap(graph, source, distance, color, active_vertices);
+}
+
+template <int K>
+void dijkstra_on_kary_heap(const Graph& graph, int source,
+                           std::vector<int>& distance) {
+  GraphKaryHeap<int, K> active_vertices(graph.size());
+  dijkstra_on_graph_heap(graph, source, distance, active_vertices);
+}
+
 template <int K>
 int dijkstra_on_kary_heap(const Graph& graph, int source, int destination) {
   std::vector<int> distance;
-  dijkstra_on_kary_heap<K>(graph, source, distance);
+  std::vector<int> color;
+  GraphKaryHeap<int, K> active_vertices(graph.size());
+  dijkstra_on_graph_heap(graph, source, distance, color, active_vertices,
+                         destination);
+  return distance[destination];
+}
+
+// settles vertices until destination, all of them if it is -1
+template <int K>
+void dijkstra_on_kary_heap_until(const CsrGraph& graph,
+                                 int source,
+                                 int destination,
+                                 std::vector<int>& distance) {
+  std::vector<int> color(graph.size(), WHITE);
+  color[source] = GRAY;
+
+  distance.assign(graph.size(), INFINITY);
+  distance[source] = 0;
+
+  GraphKaryHeap<int, K> active_vertices(graph.size());
+  active_vertices.push(source, distance[source]);
+
+  while (!active_vertices.empty()) {
+    // find min
+    int closest_active_vertex = active_vertices.top();
+    active_vertices.pop();
+    assert(color[closest_active_vertex] == GRAY);
+
+    // early terminate, not to do overflows
+    if (distance[closest_active_vertex] == INFINITY) {
+      break;
+    }
+
+    // relax
+    color[closest_active_vertex] = BLACK;
+    if (closest_active_vertex == destination) {
+      break;
+    }
+    int arcs_end = graph.arcs_end(closest_active_vertex);
+    for (int arc_index = graph.arcs_begin(closest_active_vertex);
+         arc_index < arcs_end;
+         ++arc_index) {
+      int head = graph.head(arc_index);
+      int candidate_distance = distance[closest_active_vertex] +
+          graph.weight(arc_index);
+      if (color[head] != BLACK && distance[head] > candidate_distance) {
+        distance[head] = candidate_distance;
+        if (color[head] == WHITE) {
+          color[head] = GRAY;
+          active_vertices.push(head, distance[head]);
+        } else {
+          active_vertices.decrease_key(head, distance[head]);
+        }
+      }
+    }
+  }
+}
+
+template <int K>
+void dijkstra_on_kary_heap(const CsrGraph& graph, int source,
+                           std::vector<int>& distance) {
+  dijkstra_on_kary_heap_until<K>(graph, source, -1, distance);
+}
+
+template <int K>
+int dijkstra_on_kary_heap(const CsrGraph& graph, int source, int destination) {
+  std::vector<int> distance;
+  dijkstra_on_kary_heap_until<K>(graph, source, destination, distance);
   return distance[destination];
 }
 
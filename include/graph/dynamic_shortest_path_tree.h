@@ -0,0 +1,72 @@
+/*
+ * DynamicShortestPathTree keeps distances from source and tree of
+ * shortest paths while arcs of graph change, arc weights must be
+ * non-negative. Each change repairs only vertices whose distances
+ * may change, in Ramalingam-Reps manner:
+ *   - shorter arc improves distance of its head, Dijkstra spreads
+ *     the improvement from there
+ *   - longer tree arc invalidates subtree of its head, vertices of
+ *     subtree get distances through arcs from outside of it and then
+ *     Dijkstra settles them in order
+ * Changes of other arcs take O(1) time.
+ * Basic interface:
+ *   - build from graph and source
+ *   - distance(vertex), parent(vertex)
+ *   - set_weight, add_arc, remove_arc
+ *   - affected_vertices_count() by the last change
+ */
+
+#ifndef _TOOLBOX_GRAPH_DYNAMIC_SHORTEST_PATH_TREE_H_
+#define _TOOLBOX_GRAPH_DYNAMIC_SHORTEST_PATH_TREE_H_
+
+#include <vector>
+
+#include "graph/common.h"
+#include "graph/heap.h"
+
+class DynamicShortestPathTree {
+ public:
+  DynamicShortestPathTree(const Graph& graph, int source);
+
+  int size() const { return graph_.size(); }
+  int source() const { return source_; }
+  const Graph& graph() const { return graph_; }
+
+  // INFINITY for unreachable vertices
+  int distance(int vertex) const { return distance_[vertex]; }
+  // tail of tree arc to vertex, -1 for source and unreachable
+  int parent(int vertex) const { return parent_[vertex]; }
+
+  void set_weight(int tail, int arc_index, int weight);
+  // returns index of new arc among arcs of tail
+  int add_arc(int tail, int head, int weight);
+  // the last arc of tail takes index of removed one
+  void remove_arc(int tail, int arc_index);
+
+  int affected_vertices_count() const { return affected_vertices_count_; }
+ private:
+  // arc of inverted graph, which mirrors arc from tail
+  int inverted_arc_index(int tail, int head, int weight) const;
+  void shorten_arc(int tail, int head, int weight);
+  void lengthen_arc(int tail, int head, int weight);
+  void invalidate_subtree(int root);
+  // Dijkstra from vertices in heap, which may improve others
+  void propagate();
+  void reach(int vertex, int distance, int parent);
+
+  Graph graph_;
+  Graph inverted_graph_;
+  int source_;
+
+  std::vector<int> distance_;
+  std::vector<int> parent_;
+
+  // buffers of repairs, colors are WHITE between them
+  std::vector<int> color_;
+  std::vector<int> touched_vertices_;
+  std::vector<int> subtree_vertices_;
+  GraphKaryHeap<int, 4> active_vertices_;
+  int affected_vertices_count_;
+};
+
+#endif  // _TOOLBOX_GRAPH_DYNAMIC_SHORTEST_PATH_TREE_H_
@@ -0,0 +1,96 @@
+/*
+ * Generators of benchmark graphs, output depends only on seed and
+ * parameters, not on threads count. Arcs are sampled in fixed chunks,
+ * each chunk has its own random stream, so threads take chunks in any
+ * order and graph is assembled in order of chunks.
+ * Weights are in [0, MAX_WEIGHT) unless said otherwise.
+ * Basic interface:
+ *   - RandomGenerator, splitmix64 generator of independent streams
+ *   - uniform, R-MAT, power-law (Chung-Lu) random graphs
+ *   - road-like grid, layered DAG
+ */
+
+#ifndef _TOOLBOX_GRAPH_GENERATORS_H_
+#define _TOOLBOX_GRAPH_GENERATORS_H_
+
+#include "graph/common.h"
+
+class RandomGenerator {
+ public:
+  explicit RandomGenerator(unsigned long long seed, int stream = 0)
+      : state_(mix(seed + mix(stream + 1ULL)))
+    { }
+
+  unsigned long long next() {
+    state_ += 0x9e3779b97f4a7c15ULL;
+    return mix(state_);
+  }
+
+  // uniform in [0, bound), bound is positive
+  int uniform(int bound) {
+    return static_cast<int>(((next() >> 32) * bound) >> 32);
+  }
+
+  // uniform in [0, 1)
+  double uniform_real() {
+    return (next() >> 11) * (1.0 / (1ULL << 53));
+  }
+ private:
+  static unsigned long long mix(unsigned long long value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+  }
+
+  unsigned long long state_;
+};
+
+// uniform random arcs without self-loops, vertices count is at least 2
+Graph generate_uniform_graph(int vertices_count,
+                             int arcs_count,
+                             unsigned long long seed,
+                             int threads_count);
+
+// R-MAT (recursive Kronecker) graph on 2^scale vertices: each arc
+// falls into one of quadrants of adjacency matrix with probabilities
+// 0.57, 0.19, 0.19, 0.05 recursively; skewed degrees and communities
+// of social and web graphs. Vertex ids are shuffled, self-loops are
+// resampled.
+Graph generate_rmat_graph(int scale,
+                          int arcs_count,
+                          unsigned long long seed,
+                          int threads_count);
+
+// Chung-Lu graph: ends of arcs are chosen with probabilities
+// proportional to (rank + 1)^(-1 / (exponent - 1)), so degrees follow
+// power law with given exponent, which is greater than 2.
+// Vertex ids are shuffled, self-loops are resampled.
+Graph generate_power_law_graph(int vertices_count,
+                               int arcs_count,
+                               double exponent,
+                               unsigned long long seed,
+                               int threads_count);
+
+// Road-like graph: rows x columns grid of vertices, vertex
+// row * columns + column, streets in both directions between
+// neighbours with the same weight each way in [100, 1000);
+// every ROAD_HIGHWAY_STEP-th row and column is a highway, which is
+// ROAD_HIGHWAY_SPEEDUP times faster.
+const int ROAD_HIGHWAY_STEP = 16;
+const int ROAD_HIGHWAY_SPEEDUP = 4;
+Graph generate_road_graph(int rows,
+                          int columns,
+                          unsigned long long seed,
+                          int threads_count);
+
+// DAG of layers_count layers of layer_width vertices each, vertex
+// layer * layer_width + index; arcs go from random vertex of random
+// layer but the last one to random vertex of the next layer.
+// The first layer is sources, the last one is sinks of flow networks.
+Graph generate_layered_dag(int layers_count,
+                           int layer_width,
+                           int arcs_count,
+                           unsigned long long seed,
+                           int threads_count);
+
+#endif  // _TOOLBOX_GRAPH_GENERATORS_H_
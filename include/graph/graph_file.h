@@ -0,0 +1,45 @@
+/*
+ * Binary graph file: header of four uint32 values (magic, version,
+ * vertices count, arcs count) followed by CSR arrays of int32 values
+ * in host byte order: offsets (vertices count + 1 of them), heads
+ * and weights (arcs count of each).
+ * Basic interface:
+ *   - save_graph(graph, filename)
+ *   - MappedGraph maps file into memory and gives CsrGraph view
+ *     of it, arrays are never copied, pages are read on demand;
+ *     header and offsets are checked in O(n), heads are checked
+ *     in O(m) only on request
+ */
+
+#ifndef _TOOLBOX_GRAPH_GRAPH_FILE_H_
+#define _TOOLBOX_GRAPH_GRAPH_FILE_H_
+
+#include <stddef.h>
+
+#include <string>
+
+#include "graph/common.h"
+#include "graph/csr.h"
+
+void save_graph(const Graph& graph, const std::string& filename);
+
+class MappedGraph {
+ public:
+  // throws std::runtime_error if file is not valid graph file
+  explicit MappedGraph(const std::string& filename);
+  MappedGraph(const std::string& filename, bool check_heads);
+  ~MappedGraph();
+
+  // valid while this object lives
+  const CsrGraph& graph() const { return graph_; }
+ private:
+  MappedGraph(const MappedGraph&);
+  MappedGraph& operator=(const MappedGraph&);
+  void map_file(const std::string& filename, bool check_heads);
+
+  void* data_;
+  size_t length_;
+  CsrGraph graph_;
+};
+
+#endif  // _TOOLBOX_GRAPH_GRAPH_FILE_H_
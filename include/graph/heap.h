@@ -78,6 +78,8 @@ class GraphKaryHeap {
   void pop();
   void decrease_key(int key, const T& value);
   bool empty() { return heap_size_ == 0; }
+  // removes all keys in O(size), heap can be reused after that
+  void clear();
  private:
   struct Node {
     int key;
@@ -210,4 +212,257 @@ void GraphKaryHeap<T, K>::decrease_key(int key, const T& value) {
   sift_up(heap_index);
 }
 
+template <class T, int K>
+void GraphKaryHeap<T, K>::clear() {
+  for (int heap_index = 0; heap_index < heap_size_; ++heap_index) {
+    key2index_[heap_[heap_index].key] = -1;
+  }
+  heap_size_ = 0;
+}
+
+// Monotone heap for non-negative integer values: value pushed
+// or decreased must not be less than value of last popped key.
+// Bucket i holds keys whose value differs from the last popped
+// value in the highest bit i - 1, so each key moves to lower
+// buckets at most bits count times.
+template <class T>
+class GraphRadixHeap {
+ public:
+  explicit GraphRadixHeap(int keys_count);
+  void push(int key, const T& value);
+  T get(int key);
+  int top();
+  void pop();
+  void decrease_key(int key, const T& value);
+  bool empty() { return size_ == 0; }
+ private:
+  enum { BUCKETS_COUNT = 8 * sizeof(T) + 1 };
+
+  int bucket_index(const T& value) {
+    if (value == last_value_) {
+      return 0;
+    }
+    unsigned long long difference =
+        static_cast<unsigned long long>(value ^ last_value_);
+    return 64 - __builtin_clzll(difference);
+  }
+
+  void insert(int key);
+  void erase(int key);
+  void redistribute();
+
+  std::vector< std::vector<int> > buckets_;
+  std::vector<T> values_;
+  std::vector<int> key2bucket_;
+  std::vector<int> key2position_;
+  T last_value_;
+  int size_;
+};
+
+template <class T>
+GraphRadixHeap<T>::GraphRadixHeap(int keys_count)
+    : buckets_(BUCKETS_COUNT),
+      values_(keys_count),
+      key2bucket_(keys_count, -1),
+      key2position_(keys_count, -1),
+      last_value_(0),
+      size_(0)
+  { }
+
+template <class T>
+void GraphRadixHeap<T>::insert(int key) {
+  int bucket = bucket_index(values_[key]);
+  key2bucket_[key] = bucket;
+  key2position_[key] = buckets_[bucket].size();
+  buckets_[bucket].push_back(key);
+}
+
+template <class T>
+void GraphRadixHeap<T>::erase(int key) {
+  std::vector<int>& bucket = buckets_[key2bucket_[key]];
+  int last_key = bucket.back();
+  bucket[key2position_[key]] = last_key;
+  key2position_[last_key] = key2position_[key];
+  bucket.pop_back();
+  key2bucket_[key] = -1;
+  key2position_[key] = -1;
+}
+
+// moves keys of the first non-empty bucket to lower buckets,
+// so that bucket 0 becomes non-empty
+template <class T>
+void GraphRadixHeap<T>::redistribute() {
+  int bucket = 1;
+  while (buckets_[bucket].empty()) {
+    ++bucket;
+  }
+
+  std::vector<int> keys;
+  keys.swap(buckets_[bucket]);
+  last_value_ = values_[keys[0]];
+  for (int i = 1; i < keys.size(); ++i) {
+    last_value_ = std::min(last_value_, values_[keys[i]]);
+  }
+  for (int i = 0; i < keys.size(); ++i) {
+    insert(keys[i]);
+  }
+
+  // keep memory of bucket to avoid reallocations
+  keys.clear();
+  keys.swap(buckets_[bucket]);
+}
+
+template <class T>
+void GraphRadixHeap<T>::push(int key, const T& value) {
+  assert(key >= 0 && key < key2bucket_.size());
+  assert(key2bucket_[key] == -1);
+  assert(value >= last_value_);
+  values_[key] = value;
+  insert(key);
+  ++size_;
+}
+
+template <class T>
+T GraphRadixHeap<T>::get(int key) {
+  assert(key >= 0 && key < key2bucket_.size());
+  assert(key2bucket_[key] != -1);
+  return values_[key];
+}
+
+template <class T>
+int GraphRadixHeap<T>::top() {
+  assert(!empty());
+  if (buckets_[0].empty()) {
+    redistribute();
+  }
+  return buckets_[0].back();
+}
+
+template <class T>
+void GraphRadixHeap<T>::pop() {
+  erase(top());
+  --size_;
+}
+
+template <class T>
+void GraphRadixHeap<T>::decrease_key(int key, const T& value) {
+  assert(key >= 0 && key < key2bucket_.size());
+  assert(key2bucket_[key] != -1);
+  assert(value >= last_value_);
+  erase(key);
+  values_[key] = value;
+  insert(key);
+}
+
+// Dial's bucket queue: monotone heap for non-negative integer
+// values, which at any moment lie within [v, v + max_spread]
+// where v is value of last popped key. In Dijkstra max_spread
+// is max arc weight. Buckets are intrusive lists over keys.
+template <class T>
+class GraphBucketHeap {
+ public:
+  GraphBucketHeap(int keys_count, int max_spread);
+  void push(int key, const T& value);
+  T get(int key);
+  int top();
+  void pop();
+  void decrease_key(int key, const T& value);
+  bool empty() { return size_ == 0; }
+ private:
+  int bucket_index(const T& value) {
+    return value % bucket_first_key_.size();
+  }
+
+  void insert(int key);
+  void erase(int key);
+
+  std::vector<int> bucket_first_key_;
+  std::vector<int> next_key_;
+  std::vector<int> previous_key_;
+  std::vector<T> values_;
+  std::vector<bool> is_set_;
+  T current_value_;
+  int size_;
+};
+
+template <class T>
+GraphBucketHeap<T>::GraphBucketHeap(int keys_count, int max_spread)
+    : bucket_first_key_(max_spread + 1, -1),
+      next_key_(keys_count, -1),
+      previous_key_(keys_count, -1),
+      values_(keys_count),
+      is_set_(keys_count),
+      current_value_(0),
+      size_(0)
+  { }
+
+template <class T>
+void GraphBucketHeap<T>::insert(int key) {
+  int bucket = bucket_index(values_[key]);
+  previous_key_[key] = -1;
+  next_key_[key] = bucket_first_key_[bucket];
+  if (next_key_[key] != -1) {
+    previous_key_[next_key_[key]] = key;
+  }
+  bucket_first_key_[bucket] = key;
+}
+
+template <class T>
+void GraphBucketHeap<T>::erase(int key) {
+  if (previous_key_[key] != -1) {
+    next_key_[previous_key_[key]] = next_key_[key];
+  } else {
+    bucket_first_key_[bucket_index(values_[key])] = next_key_[key];
+  }
+  if (next_key_[key] != -1) {
+    previous_key_[next_key_[key]] = previous_key_[key];
+  }
+}
+
+template <class T>
+void GraphBucketHeap<T>::push(int key, const T& value) {
+  assert(key >= 0 && key < is_set_.size());
+  assert(!is_set_[key]);
+  assert(value >= current_value_ &&
+         value - current_value_ < bucket_first_key_.size());
+  values_[key] = value;
+  is_set_[key] = true;
+  insert(key);
+  ++size_;
+}
+
+template <class T>
+T GraphBucketHeap<T>::get(int key) {
+  assert(key >= 0 && key < is_set_.size());
+  assert(is_set_[key]);
+  return values_[key];
+}
+
+template <class T>
+int GraphBucketHeap<T>::top() {
+  assert(!empty());
+  while (bucket_first_key_[bucket_index(current_value_)] == -1) {
+    ++current_value_;
+  }
+  return bucket_first_key_[bucket_index(current_value_)];
+}
+
+template <class T>
+void GraphBucketHeap<T>::pop() {
+  int key = top();
+  erase(key);
+  is_set_[key] = false;
+  --size_;
+}
+
+template <class T>
+void GraphBucketHeap<T>::decrease_key(int key, const T& value) {
+  assert(key >= 0 && key < is_set_.size());
+  assert(is_set_[key]);
+  assert(value >= current_value_);
+  erase(key);
+  values_[key] = value;
+  insert(key);
+}
+
 #endif  // GRAPH_HEAP_H
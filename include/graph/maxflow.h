@@ -2,9 +2,32 @@
 #define _TOOLBOX_GRAPH_MAXFLOW_H_
 
 #include <graph/common.h>
+#include <graph/csr.h>
 #include <vector>
 #include <utility>
 
+// Arc of flow network, which knows index of its inverse arc
+// in adjacency list of head
+struct LinkedArc {
+  int head;
+  int weight;
+  int inv_arc_index;
+
+  LinkedArc()
+      : head(-1),
+        weight(-1),
+        inv_arc_index(-1)
+  { }
+
+  LinkedArc(int h, int w, int ind)
+      : head(h),
+        weight(w),
+        inv_arc_index(ind)
+  { }
+};
+
+typedef std::vector< std::vector<LinkedArc> > LinkedGraph;
+
 // O(n * m^2)
 int edmondson_karp(const Graph& graph,
                    int source,
@@ -17,11 +40,133 @@ int relabel_to_front(const Graph& graph,
                      int destination,
                      Graph& flow);
 
+// O(n^2 * sqrt(m)), push-relabel with highest label selection,
+// global relabeling and gap heuristic on flat residual network
+int push_relabel(const Graph& graph,
+                 int source,
+                 int destination,
+                 Graph& flow);
+
+// O(n^2 * m), Dinic with current arcs and iterative search
+// on flat residual network
+int dinic(const Graph& graph,
+          int source,
+          int destination,
+          Graph& flow);
+
 // O(n^2 * m)
 int blocking_flows(const Graph& graph,
                    int source,
                    int destination,
                    Graph& flow);
+// same on compressed sparse row graph, network is packed
+// into flat residual arrays straight from it
+int blocking_flows(const CsrGraph& graph,
+                   int source,
+                   int destination,
+                   Graph& flow);
+
+// Keeps max flow and residual network between changes of network:
+// capacities may go up and down, arcs may be added. After decrease
+// below flow on arc, excess is rerouted around the arc or pushed back
+// to terminals; solve() then augments by blocking flows starting
+// from repaired flow, which is cheap for small changes.
+class MaxFlowSolver {
+ public:
+  MaxFlowSolver(const Graph& graph, int source, int destination);
+
+  // arcs of graph are numbered in order of tails, then in order
+  // of adjacency lists; added arcs get next numbers
+  int arcs_count() const { return arcs_.size(); }
+  int capacity(int arc_id) const;
+  int flow(int arc_id) const;
+
+  // throws std::logic_error if flow cut on arc can't be repaired,
+  // which never happens while flow is valid
+  void set_capacity(int arc_id, int capacity);
+  // returns id of new arc
+  int add_arc(int tail, int head, int capacity);
+
+  // returns value of max flow
+  int solve();
+  int flow_value() const;
+  void get_flow(Graph& flow) const;
+ private:
+  void reroute(int from, int to, int value);
+  int send(int from, int to, int value);
+
+  int source_;
+  int destination_;
+  Graph capacity_;
+  LinkedGraph flow_;
+  // tail and index in adjacency list of every arc id
+  std::vector< std::pair<int, int> > arcs_;
+
+  // breadth first search buffers of send()
+  std::vector< std::pair<int, int> > pred_;
+  std::vector<int> visited_;
+  std::vector<int> active_vertices_;
+};
+
+struct FlowPath {
+  std::vector<int> vertices;
+  int value;
+
+  FlowPath()
+      : value(0)
+  { }
+
+  FlowPath(const std::vector<int>& v, int val)
+      : vertices(v),
+        value(val)
+  { }
+};
+
+// Splits flow, as returned by max flow functions, into at most
+// m paths from source to destination, flow cycles are dropped
+void decompose_flow(const Graph& flow,
+                    int source,
+                    int destination,
+                    std::vector<FlowPath>& paths);
+
+struct CostArc {
+  int head;
+  int capacity;
+  int cost;
+
+  CostArc()
+      : head(-1),
+        capacity(0),
+        cost(0)
+  { }
+
+  CostArc(int h, int cap, int c)
+      : head(h),
+        capacity(cap),
+        cost(c)
+  { }
+};
+
+typedef std::vector< std::vector<CostArc> > CostGraph;
+
+// Min cost max flow: return value of max flow, cost gets
+// minimum cost among max flows.
+// Successive shortest paths: Dijkstra by costs reduced with Johnson
+// potentials, O(F * m log n). Negative costs are allowed while there
+// are no negative cycles, path costs must fit into int.
+int successive_shortest_paths(const CostGraph& graph,
+                              int source,
+                              int destination,
+                              long long& cost,
+                              Graph& flow);
+// Goldberg-Tarjan cost scaling: max flow value by Dinic, then
+// push-relabel refinements of eps-optimal flow, O(n^2 m log(nC)).
+// Negative cycles are allowed, they get saturated.
+int cost_scaling(const CostGraph& graph,
+                 int source,
+                 int destination,
+                 long long& cost,
+                 Graph& flow);
 
 // Each part has graph.size() vertices
 int get_max_bipartite_matching(const Graph& graph);
@@ -31,4 +176,16 @@ int get_max_bipartite_matching_simply(
     int right_part_size,
     const std::vector< std::pair<int, int> >& arcs);
 
+// O(sqrt(V) * E), arcs go from left part to right part,
+// left_part_matches[v] is right vertex matched with v or -1;
+// greedy initialization starts from maximal matching
+int hopcroft_karp(int left_part_size,
+                  int right_part_size,
+                  const std::vector< std::pair<int, int> >& arcs,
+                  std::vector<int>& left_part_matches,
+                  bool use_greedy_initialization);
+int hopcroft_karp(int left_part_size,
+                  int right_part_size,
+                  const std::vector< std::pair<int, int> >& arcs);
+
 #endif  // _TOOLBOX_GRAPH_MAXFLOW_H_
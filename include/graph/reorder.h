@@ -0,0 +1,48 @@
+/*
+ * Vertex reordering for cache locality: vertices close in the graph
+ * get close ids, so their arcs and entries of per-vertex arrays like
+ * distances share cache lines. Orders list old ids of vertices by
+ * their new ids: old_id[new id] = old id, new_id is inverse of it.
+ * Results computed on reordered graph are mapped back by new_id,
+ * e.g. distance of vertex v is reordered_distances[new_id[v]].
+ */
+
+#ifndef _TOOLBOX_GRAPH_REORDER_H_
+#define _TOOLBOX_GRAPH_REORDER_H_
+
+#include <vector>
+#include <utility>
+
+#include "graph/common.h"
+
+// all orders but degree one take arcs as undirected edges
+// and place components one after another
+enum VertexOrder {
+  // breadth first search from smallest unvisited vertex
+  BFS_ORDER = 0,
+  // reversed breadth first search from vertex of least degree,
+  // neighbours visited in order of increasing degree;
+  // keeps arcs close to diagonal of adjacency matrix
+  REVERSE_CUTHILL_MCKEE_ORDER,
+  // decreasing degree, hubs get packed together
+  DEGREE_ORDER
+};
+
+void vertex_order(const Graph& graph,
+                  VertexOrder order,
+                  std::vector<int>& old_id);
+
+// order of points along Hilbert space-filling curve
+void hilbert_order(const std::vector< std::pair<int, int> >& coordinates,
+                   std::vector<int>& old_id);
+
+// graph with vertex old_id[i] renamed to i, arcs keep their order
+Graph reorder(const Graph& graph,
+              const std::vector<int>& old_id,
+              std::vector<int>& new_id);
+Graph reorder(const Graph& graph,
+              VertexOrder order,
+              std::vector<int>& old_id,
+              std::vector<int>& new_id);
+
+#endif  // _TOOLBOX_GRAPH_REORDER_H_
@@ -0,0 +1,56 @@
+#ifndef _TOOLBOX_GRAPH_RESIDUAL_NETWORK_H_
+#define _TOOLBOX_GRAPH_RESIDUAL_NETWORK_H_
+
+#include <vector>
+#include "graph/common.h"
+#include "graph/csr.h"
+#include "graph/maxflow.h"
+
+// Residual network of flow problem packed into flat arrays:
+// every arc of graph gets forward residual arc with its capacity
+// and reverse residual arc with zero capacity, each one knows index
+// of its pair. Arcs of vertex v occupy [arcs_begin(v), arcs_end(v)).
+// Network built from CostGraph also keeps costs, reverse residual
+// arc costs negated cost of its pair.
+class ResidualNetwork {
+ public:
+  explicit ResidualNetwork(const Graph& graph);
+  explicit ResidualNetwork(const CsrGraph& graph);
+  explicit ResidualNetwork(const CostGraph& graph);
+
+  int size() const { return offsets_.size() - 1; }
+  int arcs_count() const { return heads_.size(); }
+
+  int arcs_begin(int vertex) const { return offsets_[vertex]; }
+  int arcs_end(int vertex) const { return offsets_[vertex + 1]; }
+
+  int head(int arc_index) const { return heads_[arc_index]; }
+  int reverse_arc(int arc_index) const { return reverse_arcs_[arc_index]; }
+  int residual_capacity(int arc_index) const {
+    return residual_capacities_[arc_index];
+  }
+  int cost(int arc_index) const { return costs_[arc_index]; }
+
+  // moves value units of flow along arc
+  void push(int arc_index, int value) {
+    residual_capacities_[arc_index] -= value;
+    residual_capacities_[reverse_arcs_[arc_index]] += value;
+  }
+
+  // flow on arcs of graph, returns net value of flow out of source
+  int extract_flow(int source, Graph& flow) const;
+  // sum of flow by cost over arcs, network must have costs
+  long long flow_cost() const;
+ private:
+  // forward_arcs gets residual arc of every arc of graph in its order
+  void initialize(const Graph& graph, std::vector<int>& forward_arcs);
+
+  std::vector<int> offsets_;
+  std::vector<int> heads_;
+  std::vector<int> reverse_arcs_;
+  std::vector<int> capacities_;
+  std::vector<int> residual_capacities_;
+  std::vector<int> costs_;
+};
+
+#endif  // _TOOLBOX_GRAPH_RESIDUAL_NETWORK_H_
@@ -0,0 +1,149 @@
+/*
+ * ShortestPathWorkspace keeps per-vertex buffers of single source
+ * shortest path algorithms between calls, so that repeated searches
+ * on big graph neither allocate nor initialize O(V) memory.
+ * Every vertex is stamped with epoch of the search which touched it
+ * last, reset() starts new epoch, and values of vertices with old
+ * stamp are read as initial ones: INFINITY distance, WHITE color.
+ * Basic interface:
+ *   - reset(vertices_count) before each search
+ *   - distance, color, parent of vertex, path to vertex
+ *   - heap and FIFO queue of active vertices
+ * Heap, queue and shortest paths tree buffers are allocated on first
+ * use, so searches which don't need them don't pay for them.
+ */
+
+#ifndef _TOOLBOX_GRAPH_SHORTEST_PATH_WORKSPACE_H_
+#define _TOOLBOX_GRAPH_SHORTEST_PATH_WORKSPACE_H_
+
+#include <vector>
+
+#include "graph/common.h"
+#include "graph/heap.h"
+
+class ShortestPathWorkspace {
+ public:
+  explicit ShortestPathWorkspace(int vertices_count = 0);
+
+  int size() const { return epoch_.size(); }
+
+  // starts new search, reallocates buffers only if vertices count
+  // has changed, otherwise takes O(1) amortized time
+  void reset(int vertices_count);
+
+  int distance(int vertex) const {
+    return is_touched(vertex) ? distance_[vertex] : INFINITY;
+  }
+  void set_distance(int vertex, int distance) {
+    touch(vertex);
+    distance_[vertex] = distance;
+  }
+
+  int color(int vertex) const {
+    return is_touched(vertex) ? color_[vertex] : WHITE;
+  }
+  void set_color(int vertex, int color) {
+    touch(vertex);
+    color_[vertex] = color;
+  }
+
+  // vertex which distance came from, -1 for source and unreached
+  int parent(int vertex) const {
+    return is_touched(vertex) ? parent_[vertex] : -1;
+  }
+  void set_parent(int vertex, int parent) {
+    touch(vertex);
+    parent_[vertex] = parent;
+  }
+
+  // shortest paths tree as doubly linked list of its vertices in
+  // preorder with their depths, subtree of vertex is the vertex and
+  // vertices deeper than it following it; tarjan_ssspp keeps it
+  // to drop subtree of vertex whose distance decreases,
+  // -1 links mark ends of list
+  int& next_in_tree(int vertex) {
+    touch_in_tree(vertex);
+    return next_in_tree_[vertex];
+  }
+  int& previous_in_tree(int vertex) {
+    touch_in_tree(vertex);
+    return previous_in_tree_[vertex];
+  }
+  int& depth_in_tree(int vertex) {
+    touch_in_tree(vertex);
+    return depth_in_tree_[vertex];
+  }
+
+  // vertices touched by current search in order of touching
+  const std::vector<int>& touched_vertices() const {
+    return touched_vertices_;
+  }
+
+  // distances of all vertices
+  void get_distances(std::vector<int>& distance) const;
+
+  // path of parents from source of last search to destination,
+  // empty if destination is unreachable
+  void get_path(int destination, std::vector<int>& path) const;
+
+  // empty at the start of each search
+  GraphKaryHeap<int, 4>& heap() {
+    if (heap_keys_count_ != size()) {
+      allocate_heap();
+    }
+    return heap_;
+  }
+
+  // FIFO queue which holds each vertex at most once
+  void enqueue(int vertex);
+  int dequeue();
+  bool queue_empty() const { return queue_size_ == 0; }
+ private:
+  bool is_touched(int vertex) const {
+    return epoch_[vertex] == current_epoch_;
+  }
+  void touch(int vertex) {
+    if (!is_touched(vertex)) {
+      epoch_[vertex] = current_epoch_;
+      distance_[vertex] = INFINITY;
+      color_[vertex] = WHITE;
+      parent_[vertex] = -1;
+      if (!next_in_tree_.empty()) {
+        next_in_tree_[vertex] = -1;
+        previous_in_tree_[vertex] = -1;
+        depth_in_tree_[vertex] = 0;
+      }
+      touched_vertices_.push_back(vertex);
+    }
+  }
+  void touch_in_tree(int vertex) {
+    if (next_in_tree_.empty()) {
+      allocate_tree();
+    }
+    touch(vertex);
+  }
+  void allocate_heap();
+  // all vertices get values of untouched ones
+  void allocate_tree();
+
+  std::vector<unsigned int> epoch_;
+  unsigned int current_epoch_;
+
+  std::vector<int> distance_;
+  std::vector<int> color_;
+  std::vector<int> parent_;
+  std::vector<int> next_in_tree_;
+  std::vector<int> previous_in_tree_;
+  std::vector<int> depth_in_tree_;
+  std::vector<int> touched_vertices_;
+
+  GraphKaryHeap<int, 4> heap_;
+  int heap_keys_count_;
+
+  // ring buffer
+  std::vector<int> queue_;
+  int queue_begin_;
+  int queue_size_;
+};
+
+#endif  // _TOOLBOX_GRAPH_SHORTEST_PATH_WORKSPACE_H_
@@ -0,0 +1,20 @@
+#ifndef _TOOLBOX_GRAPH_SPANNING_FOREST_H_
+#define _TOOLBOX_GRAPH_SPANNING_FOREST_H_
+
+#include <vector>
+#include <utility>
+#include "graph/common.h"
+
+// Minimum spanning forest of graph with arcs taken as undirected
+// edges. Arcs of forest are given by tail and index in adjacency
+// list of tail, total weight of forest is returned.
+// O(m) radix sort of arcs by weight, then DSU
+long long kruskal(const Graph& graph,
+                  std::vector< std::pair<int, int> >& forest);
+// O(m log n), in each round every component picks its lightest
+// arc in parallel, ties are broken by arc index
+long long boruvka(const Graph& graph,
+                  std::vector< std::pair<int, int> >& forest,
+                  int threads_count);
+
+#endif  // _TOOLBOX_GRAPH_SPANNING_FOREST_H_
@@ -3,6 +3,8 @@
 
 #include <vector>
 #include "graph/common.h"
+#include "graph/csr.h"
+#include "graph/shortest_path_workspace.h"
 
 // shortest paths from source to all other vertices
 void ford_bellman(const Graph& graph,
@@ -24,23 +26,106 @@ template <int K>
 void dijkstra_on_kary_heap(const Graph& graph,
                            int source,
                            std::vector<int>& shortest_paths);
+// monotone integer heaps, arc weights must be non-negative
+void dijkstra_on_radix_heap(const Graph& graph,
+                            int source,
+                            std::vector<int>& shortest_paths);
+// Dial's algorithm, memory is proportional to max arc weight,
+// so it suits graphs with small weights
+void dijkstra_on_buckets(const Graph& graph,
+                         int source,
+                         std::vector<int>& shortest_paths);
+// parallel Dijkstra relaxation in buckets of width delta,
+// arc weights must be non-negative
+void delta_stepping(const Graph& graph,
+                    int source,
+                    std::vector<int>& shortest_paths,
+                    int delta,
+                    int threads_count);
 
 // Generic case: negative cycles alowed, returns false if
 // negative cycle exists
 bool tarjan_ssspp(const Graph& graph,
                   int source,
                   std::vector<int>& shortest_paths);
+// Same for mostly acyclic graphs: strongly connected components are
+// processed in topological order, Bellman-Ford runs only inside
+// components with negative arcs, Dijkstra inside other non-trivial ones
+bool scc_ssspp(const Graph& graph,
+               int source,
+               std::vector<int>& shortest_paths);
+// Same by rounds of parallel relaxation of arcs of vertices,
+// whose distances changed in previous round
+bool parallel_ford_bellman(const Graph& graph,
+                           int source,
+                           std::vector<int>& shortest_paths,
+                           int threads_count);
 
-// shortest path between specified pair of vertices
+// shortest path between specified pair of vertices,
+// Dijkstras stop as soon as destination is settled
 int bidirected_dijkstra(const Graph& graph, int source, int destination);
+// also reports how many vertices both searches settled
+int bidirected_dijkstra(const Graph& graph,
+                        int source,
+                        int destination,
+                        int& settled_vertices_count);
 int ford_bellman(const Graph& graph, int source, int destination);
 int ford_bellman_on_queue(const Graph& graph, int source, int destination);
 int dijkstra_on_array(const Graph& graph, int source, int destination);
 int dijkstra_on_priority_queue(const Graph& graph, int source, int destination);
 int dijkstra_on_set(const Graph& graph, int source, int destination);
+int dijkstra_on_radix_heap(const Graph& graph, int source, int destination);
+int dijkstra_on_buckets(const Graph& graph, int source, int destination);
+int delta_stepping(const Graph& graph, int source, int destination,
+                   int delta, int threads_count);
 template <int K>
 int dijkstra_on_kary_heap(const Graph& graph, int source, int destination);
 
+// shortest paths from each of sources to each of targets,
+// table is flat row-major matrix: distance from sources[i]
+// to targets[j] is table[i * targets.size() + j];
+// each Dijkstra stops as soon as all targets are settled
+void distance_table(const Graph& graph,
+                    const std::vector<int>& sources,
+                    const std::vector<int>& targets,
+                    std::vector<int>& table);
+
+// same algorithms on reusable workspace, which is reset by each call,
+// distances are read by workspace.distance(vertex);
+// point-to-point Dijkstras stop as soon as destination is settled,
+// workspace.get_path(destination, path) restores the path
+void dijkstra_on_kary_heap(const Graph& graph,
+                           int source,
+                           ShortestPathWorkspace& workspace);
+void dijkstra_on_set(const Graph& graph,
+                     int source,
+                     ShortestPathWorkspace& workspace);
+void ford_bellman_on_queue(const Graph& graph,
+                           int source,
+                           ShortestPathWorkspace& workspace);
+bool tarjan_ssspp(const Graph& graph,
+                  int source,
+                  ShortestPathWorkspace& workspace);
+
+int dijkstra_on_kary_heap(const Graph& graph, int source, int destination,
+                          ShortestPathWorkspace& workspace);
+int dijkstra_on_set(const Graph& graph, int source, int destination,
+                    ShortestPathWorkspace& workspace);
+int ford_bellman_on_queue(const Graph& graph, int source, int destination,
+                          ShortestPathWorkspace& workspace);
+
+// same algorithms on compressed sparse row graph
+void ford_bellman_on_queue(const CsrGraph& graph,
+                           int source,
+                           std::vector<int>& shortest_paths);
+template <int K>
+void dijkstra_on_kary_heap(const CsrGraph& graph,
+                           int source,
+                           std::vector<int>& shortest_paths);
+
+int ford_bellman_on_queue(const CsrGraph& graph, int source, int destination);
+template <int K>
+int dijkstra_on_kary_heap(const CsrGraph& graph, int source, int destination);
 
 #include "dijkstra-inl.h" // NOLINT
 
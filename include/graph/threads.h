@@ -0,0 +1,133 @@
+#ifndef _TOOLBOX_GRAPH_THREADS_H_
+#define _TOOLBOX_GRAPH_THREADS_H_
+
+#include <pthread.h>
+
+#include <vector>
+#include <cassert>
+#include <stdexcept>
+
+// Created threads wait for all others to be created, so that
+// failure to create some thread cancels all of them before
+// any worker starts; workers waiting on barriers for missing
+// threads would never finish otherwise.
+class ThreadsStart {
+ public:
+  ThreadsStart()
+      : state_(WAITING) {
+    pthread_mutex_init(&mutex_, NULL);
+    pthread_cond_init(&changed_, NULL);
+  }
+
+  ~ThreadsStart() {
+    pthread_cond_destroy(&changed_);
+    pthread_mutex_destroy(&mutex_);
+  }
+
+  // returns false if threads are cancelled
+  bool wait() {
+    pthread_mutex_lock(&mutex_);
+    while (state_ == WAITING) {
+      pthread_cond_wait(&changed_, &mutex_);
+    }
+    bool started = state_ == STARTED;
+    pthread_mutex_unlock(&mutex_);
+    return started;
+  }
+
+  void release(bool start) {
+    pthread_mutex_lock(&mutex_);
+    state_ = start ? STARTED : CANCELLED;
+    pthread_cond_broadcast(&changed_);
+    pthread_mutex_unlock(&mutex_);
+  }
+ private:
+  ThreadsStart(const ThreadsStart&);
+  ThreadsStart& operator=(const ThreadsStart&);
+
+  enum State {WAITING, STARTED, CANCELLED};
+
+  pthread_mutex_t mutex_;
+  pthread_cond_t changed_;
+  State state_;
+};
+
+template <class Worker>
+struct ThreadTask {
+  Worker* worker;
+  int thread_index;
+  ThreadsStart* start;
+};
+
+template <class Worker>
+void* run_thread_task(void* argument) {
+  ThreadTask<Worker>* task = static_cast< ThreadTask<Worker>* >(argument);
+  if (task->start->wait()) {
+    task->worker->run(task->thread_index);
+  }
+  return NULL;
+}
+
+// Calls worker.run(thread_index) for each thread_index in
+// [0, threads_count), index 0 runs in calling thread.
+// Returns when all threads are finished. Throws std::runtime_error
+// if some thread can't be created, then no worker runs.
+template <class Worker>
+void run_in_threads(Worker& worker, int threads_count) {
+  assert(threads_count > 0);
+  ThreadsStart start;
+  std::vector<pthread_t> threads(threads_count);
+  std::vector< ThreadTask<Worker> > tasks(threads_count);
+  for (int thread_index = 0; thread_index < threads_count; ++thread_index) {
+    tasks[thread_index].worker = &worker;
+    tasks[thread_index].thread_index = thread_index;
+    tasks[thread_index].start = &start;
+  }
+
+  int created_count = 1;
+  while (created_count < threads_count &&
+         pthread_create(&threads[created_count], NULL,
+                        run_thread_task<Worker>,
+                        &tasks[created_count]) == 0) {
+    ++created_count;
+  }
+  start.release(created_count == threads_count);
+
+  if (created_count == threads_count) {
+    worker.run(0);
+  }
+
+  for (int thread_index = 1; thread_index < created_count; ++thread_index) {
+    pthread_join(threads[thread_index], NULL);
+  }
+  if (created_count < threads_count) {
+    throw std::runtime_error("can't create thread");
+  }
+}
+
+// Sets *value = min(*value, candidate) atomically,
+// returns true if value was changed
+inline bool atomic_min(int* value, int candidate) {
+  int current = *value;
+  while (candidate < current) {
+    if (__sync_bool_compare_and_swap(value, current, candidate)) {
+      return true;
+    }
+    current = *value;
+  }
+  return false;
+}
+
+inline bool atomic_min(unsigned long long* value,
+                       unsigned long long candidate) {
+  unsigned long long current = *value;
+  while (candidate < current) {
+    if (__sync_bool_compare_and_swap(value, current, candidate)) {
+      return true;
+    }
+    current = *value;
+  }
+  return false;
+}
+
+#endif  // _TOOLBOX_GRAPH_THREADS_H_